@@ -0,0 +1,127 @@
+// Load time and attribute-query latency for AlnRegistry over a synthetic
+// registry, against re-parsing the file for each query as ad hoc tooling
+// does.
+//
+// usage: aln_registry_bench [rows] [iterations]
+#include "aln_registry.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+namespace {
+
+double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+long currentRssKb() {
+    long pages = 0, resident = 0;
+    std::FILE* statm = std::fopen("/proc/self/statm", "r");
+    if (statm) {
+        if (std::fscanf(statm, "%ld %ld", &pages, &resident) != 2) {
+            resident = 0;
+        }
+        std::fclose(statm);
+    }
+    return resident * (sysconf(_SC_PAGESIZE) / 1024);
+}
+
+void writeRegistry(const std::string& path, size_t rows) {
+    const char* roles[] = {"ContentGovernor", "BCIStreamFilter", "XRSceneGuard", "AuditRelay"};
+    const char* devices[] = {"BCIEdge", "ClusterNode", "XRHeadset", "Gateway", "Wearable"};
+    const char* compliance[] = {"GDPR+EUAI+HIPAA", "FCC15+MedDevice", "GDPR+EUAI",
+                                "HIPAA+MedDevice", "EUAI", "GDPR+HIPAA+FCC15"};
+    std::mt19937 gen(23);
+    std::ofstream out(path);
+    out << "filename," << path << "\ndestination-folder,/tmp\n"
+        << "destination-path,module,version,role,device-type,compliance,log-persistence\n";
+    for (size_t row = 0; row < rows; ++row) {
+        out << "vnode/ethics/node-" << row << ".aln,Module" << gen() % 5000 << ",1.0."
+            << gen() % 10 << "," << roles[gen() % 4] << "," << devices[gen() % 5] << ","
+            << compliance[gen() % 6] << ",Ledger" << gen() % 3 << "\n";
+    }
+}
+
+// Ad hoc path: stream the file and split every row for each query
+size_t scanFile(const std::string& path) {
+    std::ifstream in(path);
+    std::string line, field;
+    size_t matches = 0;
+    for (int skip = 0; skip < 3 && std::getline(in, line); ++skip) {}
+    while (std::getline(in, line)) {
+        std::stringstream ss(line);
+        std::vector<std::string> fields;
+        while (std::getline(ss, field, ',')) {
+            fields.push_back(field);
+        }
+        if (fields.size() != 7 || fields[4] != "BCIEdge") {
+            continue;
+        }
+        std::stringstream items(fields[5]);
+        while (std::getline(items, field, '+')) {
+            if (field == "HIPAA") {
+                matches++;
+                break;
+            }
+        }
+    }
+    return matches;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    size_t rows = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    int iterations = argc > 2 ? std::atoi(argv[2]) : 100;
+    if (rows == 0 || iterations <= 0) {
+        std::fprintf(stderr, "usage: %s [rows] [iterations]\n", argv[0]);
+        return 1;
+    }
+
+    const std::string path = "/tmp/phoenix_aln_bench_" + std::to_string(getpid()) + ".aln";
+    writeRegistry(path, rows);
+
+    const long before_kb = currentRssKb();
+    auto start = std::chrono::steady_clock::now();
+    AlnRegistry registry = loadAlnRegistry(path);
+    double load_seconds = secondsSince(start);
+    const long loaded_kb = currentRssKb();
+
+    size_t indexed = 0;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        auto hits = registry.whereContains("compliance", "HIPAA") &
+                    registry.whereEquals("device-type", "BCIEdge");
+        indexed = hits.count();
+    }
+    double query_seconds = secondsSince(start) / iterations;
+
+    size_t sparse = 0;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        sparse = registry.whereEquals("module", "Module42").count();
+    }
+    double sparse_seconds = secondsSince(start) / iterations;
+
+    start = std::chrono::steady_clock::now();
+    size_t scanned = scanFile(path);
+    double scan_seconds = secondsSince(start);
+    std::remove(path.c_str());
+
+    std::printf("rows=%zu load=%.1fms (%.0f ns/row) registry_rss=%ldMB\n",
+                registry.rowCount(), load_seconds * 1e3, load_seconds * 1e9 / rows,
+                (loaded_kb - before_kb) / 1024);
+    std::printf("compliance~HIPAA & device-type=BCIEdge: %.3fms/query, %zu rows; "
+                "re-parse scan %.1fms, %zu rows %s\n",
+                query_seconds * 1e3, indexed, scan_seconds * 1e3, scanned,
+                indexed == scanned ? "(match)" : "(MISMATCH)");
+    std::printf("module=Module42 (posting list): %.1fus/query, %zu rows\n",
+                sparse_seconds * 1e6, sparse);
+    return indexed == scanned ? 0 : 1;
+}
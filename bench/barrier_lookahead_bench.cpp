@@ -0,0 +1,90 @@
+// Latency of one BarrierLookahead::evaluate call over a batch of candidate
+// actions, against the 20 ms BCI control-loop budget, for box-extreme and
+// sampled disturbance sets.
+//
+// usage: barrier_lookahead_bench [candidates] [horizon] [samples] [iterations]
+#include "barrier_lookahead.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+namespace {
+
+const double kBudgetMs = 20.0;
+
+void run(const char* name, const BarrierLookahead& lookahead, const CyberswarmKernel& kernel,
+         const std::vector<double>& candidates, const std::vector<double>& disturbances,
+         int iterations) {
+    std::vector<double> ms;
+    size_t accepted = 0;
+    for (int i = 0; i < iterations; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        auto result = lookahead.evaluate(kernel, candidates, disturbances);
+        ms.push_back(std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - start).count());
+        accepted = std::count(result.begin(), result.end(), 1);
+    }
+    std::sort(ms.begin(), ms.end());
+    const size_t axes = kernel.getConstraints().size();
+    const size_t samples = disturbances.empty() ? 1 : disturbances.size() / axes;
+    const double p99 = ms[std::min(ms.size() - 1, static_cast<size_t>(0.99 * ms.size()))];
+    std::printf("%-10s candidates=%zu samples=%zu horizon=%d accepted=%zu "
+                "median=%.3fms p99=%.3fms max=%.3fms ns/axis-step=%.2f %s\n",
+                name, candidates.size() / axes, samples, lookahead.getHorizon(), accepted,
+                ms[ms.size() / 2], p99, ms.back(),
+                ms[ms.size() / 2] * 1e6 /
+                    (static_cast<double>(candidates.size()) * samples * lookahead.getHorizon()),
+                p99 <= kBudgetMs ? "within 20ms" : "OVER 20ms BUDGET");
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    size_t candidate_count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 4096;
+    int horizon = argc > 2 ? std::atoi(argv[2]) : 10;
+    size_t sample_count = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 64;
+    int iterations = argc > 4 ? std::atoi(argv[4]) : 200;
+    if (candidate_count == 0 || horizon <= 0 || iterations <= 0) {
+        std::fprintf(stderr, "usage: %s [candidates] [horizon] [samples] [iterations]\n", argv[0]);
+        return 1;
+    }
+
+    CyberswarmKernel kernel;
+    const auto& constraints = kernel.getConstraints();
+    const size_t axes = constraints.size();
+    std::mt19937 gen(9);
+    for (size_t a = 0; a < axes; ++a) {
+        kernel.updateConstraint(a, 0.5 * (constraints[a].min_value + constraints[a].max_value));
+    }
+
+    BarrierLookahead lookahead(axes, horizon);
+    for (size_t a = 0; a < axes; ++a) {
+        lookahead.setAxisDynamics(a, {0.9, 0.1});
+    }
+
+    std::vector<double> candidates(candidate_count * axes);
+    std::vector<double> radius(axes);
+    for (size_t a = 0; a < axes; ++a) {
+        double span = constraints[a].max_value - constraints[a].min_value;
+        radius[a] = 0.01 * span;
+        std::uniform_real_distribution<> push(-span, span);
+        for (size_t c = 0; c < candidate_count; ++c) {
+            candidates[c * axes + a] = push(gen);
+        }
+    }
+
+    std::vector<double> sampled(sample_count * axes);
+    for (size_t i = 0; i < sampled.size(); ++i) {
+        sampled[i] = std::uniform_real_distribution<>(-1.0, 1.0)(gen) * radius[i % axes];
+    }
+
+    run("undisturbed", lookahead, kernel, candidates, {}, iterations);
+    run("box", lookahead, kernel, candidates, boxExtremeDisturbances(radius), iterations);
+    if (sample_count > 0) {
+        run("sampled", lookahead, kernel, candidates, sampled, iterations);
+    }
+    return 0;
+}
@@ -0,0 +1,145 @@
+// Allocations per vote and resident memory for CybercorePolicy HEAP vs
+// ARENA storage. Each mode runs in its own child process so peak RSS is
+// measured independently.
+//
+// usage: policy_storage_bench [total_votes] [votes_per_decision]
+#include "cybercore_policy.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+namespace {
+
+std::atomic<uint64_t> allocation_count{0};
+
+long currentRssKb() {
+    long pages = 0, resident = 0;
+    std::FILE* statm = std::fopen("/proc/self/statm", "r");
+    if (statm) {
+        if (std::fscanf(statm, "%ld %ld", &pages, &resident) != 2) {
+            resident = 0;
+        }
+        std::fclose(statm);
+    }
+    return resident * (sysconf(_SC_PAGESIZE) / 1024);
+}
+
+long peakRssKb() {
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+void runMode(PolicyStorage mode, size_t total_votes, size_t votes_per_decision,
+             const std::vector<std::string>& identifiers,
+             const std::vector<std::string>& rationales) {
+    const char* name = mode == PolicyStorage::ARENA ? "ARENA" : "HEAP";
+    const long baseline_kb = currentRssKb();
+
+    CybercorePolicy policy(mode);
+    std::vector<std::string> decision_ids;
+    decision_ids.reserve(total_votes / votes_per_decision + 1);
+
+    uint64_t vote_allocations = 0;
+    double vote_seconds = 0.0;
+    size_t cast = 0;
+    while (cast < total_votes) {
+        decision_ids.push_back(policy.proposeDecision("benchmark decision",
+                                                      {"neurorights.agency"}));
+        const std::string& id = decision_ids.back();
+
+        uint64_t before = allocation_count.load(std::memory_order_relaxed);
+        auto start = std::chrono::steady_clock::now();
+        for (size_t v = 0; v < votes_per_decision && cast < total_votes; ++v, ++cast) {
+            policy.castVote(id, static_cast<StakeholderType>(v % 6),
+                            identifiers[v % identifiers.size()], v % 3 != 0,
+                            rationales[v % rationales.size()]);
+        }
+        vote_seconds += std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start).count();
+        vote_allocations += allocation_count.load(std::memory_order_relaxed) - before;
+    }
+    const long loaded_kb = currentRssKb();
+
+    for (const auto& id : decision_ids) {
+        policy.finalizeDecision(id);
+    }
+    policy.archiveFinalizedDecisions();
+    size_t released = policy.releaseUnusedMemory();
+#ifdef __GLIBC__
+    malloc_trim(0);
+#endif
+    const long archived_kb = currentRssKb();
+
+    std::printf("%-5s votes=%zu decisions=%zu allocs/vote=%.3f ns/vote=%.1f "
+                "rss_baseline=%ldMB rss_loaded=%ldMB peak_rss=%ldMB "
+                "rss_after_archive=%ldMB pool_bytes_released=%zuMB\n",
+                name, cast, decision_ids.size(),
+                static_cast<double>(vote_allocations) / cast,
+                vote_seconds * 1e9 / cast,
+                baseline_kb / 1024, loaded_kb / 1024, peakRssKb() / 1024,
+                archived_kb / 1024, released >> 20);
+}
+
+}  // namespace
+
+void* operator new(size_t size) {
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    std::free(p);
+}
+
+int main(int argc, char** argv) {
+    size_t total_votes = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+    size_t votes_per_decision = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1000;
+    if (total_votes == 0 || votes_per_decision == 0) {
+        std::fprintf(stderr, "usage: %s [total_votes] [votes_per_decision]\n", argv[0]);
+        return 1;
+    }
+
+    // DIDs longer than the small-string buffer, as in production
+    std::vector<std::string> identifiers;
+    for (size_t i = 0; i < votes_per_decision; ++i) {
+        identifiers.push_back("did:phx:stakeholder:" + std::to_string(100000 + i));
+    }
+    std::vector<std::string> rationales = {
+        "",
+        "Within cognitive-load envelope",
+        "Requires neurorights.privacy review before CI/CD promotion",
+        "Approved subject to state-only exposure: no raw neural waveforms leave "
+        "the ingress node and dream content is never persisted",
+    };
+
+    for (PolicyStorage mode : {PolicyStorage::HEAP, PolicyStorage::ARENA}) {
+        std::fflush(stdout);
+        pid_t child = fork();
+        if (child == 0) {
+            runMode(mode, total_votes, votes_per_decision, identifiers, rationales);
+            std::fflush(stdout);
+            _exit(0);
+        }
+        int status = 0;
+        waitpid(child, &status, 0);
+    }
+    return 0;
+}
@@ -0,0 +1,157 @@
+// Reader latency on the snapshot hot path (pin, checkViability, summary)
+// while the shard is reparsed and republished back to back, compared with
+// the same readers on a quiet watcher.
+//
+// usage: snapshot_reload_bench [reader_threads] [seconds] [shard_rows]
+#include "shard_snapshot.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+
+namespace {
+
+namespace fs = std::filesystem;
+
+void writeShard(const fs::path& path, size_t rows) {
+    std::ofstream out(path);
+    out << "nodeid,layer,region,latitude,longitude,parameter,unit,value,window,ecoimpactscore,notes\n"
+        << "PHX-N1-INGRESS,BCIIngress,Phoenix-AZ,33.4522,-112.0738,GatewayPowerDraw,mW,750,"
+        << "2026-01-01/2026-12-31,0.82,ingress\n"
+        << "PHX-CYBERSWARM,GovSafety,Phoenix-AZ,33.4522,-112.0738,MaxCognitiveLoadIndex,unitless,0.7,"
+        << "2026-01-01/2026-12-31,0.88,barrier\n"
+        << "PHX-CYBERCORE,GovOS,Phoenix-AZ,33.4522,-112.0738,ConsensusThreshold,ratio,0.7,"
+        << "2026-01-01/2026-12-31,0.91,consensus\n";
+    for (size_t i = 3; i < rows; ++i) {
+        out << "PHX-WATER-" << i << ",EcoLink,Phoenix-AZ,33.85,-112.27,PFBSLakePleasant,ngL,3.9,"
+            << "2024-11-15/2024-11-15,0.88,PFBS reading\n";
+    }
+}
+
+// Per-thread latency histogram in 10 ns buckets up to 1 ms
+const size_t kBucketNs = 10;
+const size_t kBuckets = 100000;
+
+struct LatencyStats {
+    uint64_t reads = 0;
+    double p50 = 0, p99 = 0, p999 = 0, max = 0;
+};
+
+LatencyStats runReaders(ShardWatcher& watcher, int threads, double seconds,
+                        const std::function<void()>& background) {
+    const std::vector<double> action = {0.5, 0.5, 50.0, 500.0, 0.5, 0.6, 0.5};
+    std::atomic<bool> done{false};
+    std::vector<std::vector<uint64_t>> histograms(threads, std::vector<uint64_t>(kBuckets + 1));
+    std::vector<int64_t> max_ns(threads, 0);
+    std::vector<std::thread> readers;
+    for (int t = 0; t < threads; ++t) {
+        readers.emplace_back([&, t] {
+            auto& histogram = histograms[t];
+            double sink = 0.0;
+            while (!done.load(std::memory_order_relaxed)) {
+                auto start = std::chrono::steady_clock::now();
+                {
+                    auto snapshot = watcher.read();
+                    sink += snapshot->kernel.checkViability(action) +
+                            snapshot->summary.avgEcoImpactScore;
+                }
+                int64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - start).count();
+                histogram[std::min<size_t>(ns / kBucketNs, kBuckets)]++;
+                max_ns[t] = std::max(max_ns[t], ns);
+            }
+            if (sink < 0) {
+                std::printf("%f\n", sink);
+            }
+        });
+    }
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::duration<double>(seconds);
+    while (std::chrono::steady_clock::now() < deadline) {
+        if (background) {
+            background();
+        } else {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    done = true;
+    for (auto& r : readers) {
+        r.join();
+    }
+
+    std::vector<uint64_t> histogram(kBuckets + 1, 0);
+    LatencyStats stats;
+    for (int t = 0; t < threads; ++t) {
+        for (size_t b = 0; b <= kBuckets; ++b) {
+            histogram[b] += histograms[t][b];
+            stats.reads += histograms[t][b];
+        }
+        stats.max = std::max(stats.max, static_cast<double>(max_ns[t]));
+    }
+    auto at = [&](double q) {
+        uint64_t target = static_cast<uint64_t>(q * stats.reads), seen = 0;
+        for (size_t b = 0; b <= kBuckets; ++b) {
+            seen += histogram[b];
+            if (seen > target) {
+                return static_cast<double>(b * kBucketNs);
+            }
+        }
+        return stats.max;
+    };
+    stats.p50 = at(0.5);
+    stats.p99 = at(0.99);
+    stats.p999 = at(0.999);
+    return stats;
+}
+
+void report(const char* name, const LatencyStats& stats, double seconds) {
+    std::printf("%-12s reads/s=%.0f p50=%.0fns p99=%.0fns p99.9=%.0fns max=%.0fns\n",
+                name, stats.reads / seconds, stats.p50, stats.p99, stats.p999, stats.max);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    int threads = argc > 1 ? std::atoi(argv[1]) : 4;
+    double seconds = argc > 2 ? std::atof(argv[2]) : 2.0;
+    size_t rows = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 10000;
+    if (threads <= 0 || seconds <= 0 || rows < 3) {
+        std::fprintf(stderr, "usage: %s [reader_threads] [seconds] [shard_rows]\n", argv[0]);
+        return 1;
+    }
+
+    fs::path dir = fs::temp_directory_path() /
+                   ("phoenix_reload_bench_" + std::to_string(getpid()));
+    fs::create_directories(dir);
+    const fs::path shard = dir / "shard.csv";
+    writeShard(shard, rows);
+
+    {
+        ShardWatcher watcher(shard.string());
+        report("quiet", runReaders(watcher, threads, seconds, nullptr), seconds);
+
+        size_t reloads = 0;
+        auto start = std::chrono::steady_clock::now();
+        auto storm = runReaders(watcher, threads, seconds, [&] {
+            watcher.reloadNow();
+            reloads++;
+        });
+        double storm_seconds = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start).count();
+        report("reload-storm", storm, seconds);
+        std::printf("reloads=%zu (%.1f/s, %zu rows each) failed=%llu\n",
+                    reloads, reloads / storm_seconds, rows,
+                    static_cast<unsigned long long>(watcher.failedReloads()));
+    }
+
+    fs::remove_all(dir);
+    return 0;
+}
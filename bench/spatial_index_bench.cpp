@@ -0,0 +1,101 @@
+// Grid index vs linear scan for radius and nearest queries over a
+// synthetic continental node table.
+//
+// usage: spatial_index_bench [node_count] [query_count]
+#include "spatial_index.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace {
+
+double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    size_t node_count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    size_t query_count = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 200;
+    if (node_count == 0 || query_count == 0) {
+        std::fprintf(stderr, "usage: %s [node_count] [query_count]\n", argv[0]);
+        return 1;
+    }
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<> lat(25.0, 49.0), lon(-125.0, -67.0);
+    std::vector<NeuroNode> nodes(node_count);
+    for (size_t i = 0; i < node_count; ++i) {
+        nodes[i].latitude = lat(gen);
+        nodes[i].longitude = lon(gen);
+        nodes[i].layer = i % 2 ? "EcoLink" : "BCIIngress";
+    }
+    std::vector<double> query_lat(query_count), query_lon(query_count);
+    for (size_t q = 0; q < query_count; ++q) {
+        query_lat[q] = lat(gen);
+        query_lon[q] = lon(gen);
+    }
+    const double radius_km = 25.0;
+
+    auto start = std::chrono::steady_clock::now();
+    NodeSpatialIndex index(nodes);
+    double build_seconds = secondsSince(start);
+
+    size_t grid_hits = 0;
+    start = std::chrono::steady_clock::now();
+    for (size_t q = 0; q < query_count; ++q) {
+        grid_hits += index.queryRadius(query_lat[q], query_lon[q], radius_km).size();
+    }
+    double grid_radius = secondsSince(start);
+
+    size_t scan_hits = 0;
+    start = std::chrono::steady_clock::now();
+    for (size_t q = 0; q < query_count; ++q) {
+        for (const auto& n : nodes) {
+            if (haversineKm(query_lat[q], query_lon[q], n.latitude, n.longitude) <= radius_km) {
+                scan_hits++;
+            }
+        }
+    }
+    double scan_radius = secondsSince(start);
+
+    double grid_sum = 0.0;
+    start = std::chrono::steady_clock::now();
+    for (size_t q = 0; q < query_count; ++q) {
+        size_t node;
+        double distance;
+        index.nearest(query_lat[q], query_lon[q], node, distance);
+        grid_sum += distance;
+    }
+    double grid_nearest = secondsSince(start);
+
+    double scan_sum = 0.0;
+    start = std::chrono::steady_clock::now();
+    for (size_t q = 0; q < query_count; ++q) {
+        double best = std::numeric_limits<double>::infinity();
+        for (const auto& n : nodes) {
+            best = std::min(best, haversineKm(query_lat[q], query_lon[q], n.latitude, n.longitude));
+        }
+        scan_sum += best;
+    }
+    double scan_nearest = secondsSince(start);
+
+    std::printf("nodes=%zu queries=%zu build=%.1fms cell=%.4fdeg\n",
+                node_count, query_count, build_seconds * 1e3, index.cellDegrees());
+    std::printf("radius %.0fkm: grid=%.2fus/query scan=%.2fus/query hits %s\n",
+                radius_km, grid_radius * 1e6 / query_count, scan_radius * 1e6 / query_count,
+                grid_hits == scan_hits ? "match" : "MISMATCH");
+    std::printf("nearest: grid=%.2fus/query scan=%.2fus/query distances %s\n",
+                grid_nearest * 1e6 / query_count, scan_nearest * 1e6 / query_count,
+                grid_sum == scan_sum ? "match" : "MISMATCH");
+
+    auto start_batch = std::chrono::steady_clock::now();
+    auto matches = nearestEcoLinkForIngress(nodes);
+    std::printf("nearestEcoLinkForIngress: %zu ingress nodes in %.1fms\n",
+                matches.size(), secondsSince(start_batch) * 1e3);
+    return grid_hits == scan_hits && grid_sum == scan_sum ? 0 : 1;
+}
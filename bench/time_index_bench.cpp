@@ -0,0 +1,96 @@
+// "Which readings were active on day D" over years of readings: the old
+// path re-parses every window string per query, the interval tree answers
+// from integer bounds parsed once at load.
+//
+// usage: time_index_bench [reading_count] [query_count]
+#include "time_index.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+namespace {
+
+double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+std::string isoDay(int32_t day) {
+    // Inverse of the civil-day count, days since 1970-01-01
+    day += 719468;
+    const int era = (day >= 0 ? day : day - 146096) / 146097;
+    const unsigned doe = static_cast<unsigned>(day - era * 146097);
+    const unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const unsigned mp = (5 * doy + 2) / 153;
+    const unsigned d = doy - (153 * mp + 2) / 5 + 1;
+    const unsigned m = mp < 10 ? mp + 3 : mp - 9;
+    const int y = static_cast<int>(yoe) + era * 400 + (m <= 2);
+    char text[16];
+    std::snprintf(text, sizeof(text), "%04d-%02u-%02u", y, m, d);
+    return text;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    size_t reading_count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    size_t query_count = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 100;
+    if (reading_count == 0 || query_count == 0) {
+        std::fprintf(stderr, "usage: %s [reading_count] [query_count]\n", argv[0]);
+        return 1;
+    }
+
+    // Ten years of daily to monthly sampling windows
+    std::mt19937 gen(11);
+    std::uniform_int_distribution<int32_t> start(16071, 19723), length(0, 30);
+    std::vector<NeuroNode> nodes(reading_count);
+    for (auto& n : nodes) {
+        int32_t s = start(gen);
+        n.window = isoDay(s) + "/" + isoDay(s + length(gen));
+    }
+
+    auto begin = std::chrono::steady_clock::now();
+    for (auto& n : nodes) {
+        parseWindowDays(n.window, n.windowStartDay, n.windowEndDay);
+    }
+    double parse_seconds = secondsSince(begin);
+
+    begin = std::chrono::steady_clock::now();
+    NodeTimeIndex index(nodes);
+    double build_seconds = secondsSince(begin);
+
+    std::vector<int32_t> days(query_count);
+    for (auto& d : days) {
+        d = start(gen);
+    }
+
+    size_t scan_hits = 0;
+    begin = std::chrono::steady_clock::now();
+    for (int32_t d : days) {
+        for (const auto& n : nodes) {
+            int32_t s, e;
+            if (parseWindowDays(n.window, s, e) && s <= d && d <= e) {
+                scan_hits++;
+            }
+        }
+    }
+    double scan_seconds = secondsSince(begin);
+
+    size_t tree_hits = 0;
+    begin = std::chrono::steady_clock::now();
+    for (int32_t d : days) {
+        tree_hits += index.activeOn(d).size();
+    }
+    double tree_seconds = secondsSince(begin);
+
+    std::printf("readings=%zu queries=%zu parse=%.1fms build=%.1fms\n",
+                reading_count, query_count, parse_seconds * 1e3, build_seconds * 1e3);
+    std::printf("activeOn: string scan=%.1fus/query interval tree=%.1fus/query "
+                "(%.1f matches/query) hits %s\n",
+                scan_seconds * 1e6 / query_count, tree_seconds * 1e6 / query_count,
+                static_cast<double>(tree_hits) / query_count,
+                scan_hits == tree_hits ? "match" : "MISMATCH");
+    return scan_hits == tree_hits ? 0 : 1;
+}
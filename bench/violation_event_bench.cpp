@@ -0,0 +1,83 @@
+// Cost of CyberswarmKernel::updateConstraint with and without an event
+// sink, and with every update crossing a bound, against building the text
+// violation report per crossing.
+//
+// usage: violation_event_bench [updates]
+#include "cyberswarm_kernel.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+namespace {
+
+const size_t kCognitiveAxis = 5;  // bounds [0, 0.7]
+
+double nsPerUpdate(CyberswarmKernel& kernel, size_t updates, double low, double high) {
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < updates; ++i) {
+        kernel.updateConstraint(kCognitiveAxis, i & 1 ? high : low);
+    }
+    return std::chrono::duration<double, std::nano>(
+        std::chrono::steady_clock::now() - start).count() / updates;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    size_t updates = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+    if (updates == 0) {
+        std::fprintf(stderr, "usage: %s [updates]\n", argv[0]);
+        return 1;
+    }
+
+    CyberswarmKernel kernel;
+    double no_sink = nsPerUpdate(kernel, updates, 0.2, 0.4);
+
+    ViolationEventRing ring(1 << 16);
+    kernel.attachEventSink(&ring);
+    double quiet = nsPerUpdate(kernel, updates, 0.2, 0.4);
+
+    // Consumer drains to a binary log while every update crosses the bound
+    std::FILE* log = std::fopen("/dev/null", "wb");
+    std::atomic<bool> done{false};
+    size_t written = 0;
+    std::thread consumer([&] {
+        while (!done.load(std::memory_order_acquire)) {
+            size_t n = drainViolationEventsToFile(ring, log);
+            written += n;
+            if (n == 0) {
+                std::this_thread::yield();
+            }
+        }
+        written += drainViolationEventsToFile(ring, log);
+    });
+    double crossing = nsPerUpdate(kernel, updates, 0.2, 0.9);
+    done.store(true, std::memory_order_release);
+    consumer.join();
+    std::fclose(log);
+
+    // Old path: poll and format the text report on each crossing
+    kernel.attachEventSink(nullptr);
+    size_t report_updates = updates / 100 + 1;
+    size_t report_bytes = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < report_updates; ++i) {
+        kernel.updateConstraint(kCognitiveAxis, i & 1 ? 0.9 : 0.2);
+        if (kernel.getConstraints()[kCognitiveAxis].is_violated) {
+            report_bytes += kernel.getViolationReport().size();
+        }
+    }
+    double report = std::chrono::duration<double, std::nano>(
+        std::chrono::steady_clock::now() - start).count() / report_updates;
+
+    std::printf("updates=%zu event=%zu bytes\n", updates, sizeof(ViolationEvent));
+    std::printf("no sink:             %.1f ns/update\n", no_sink);
+    std::printf("sink, no crossings:  %.1f ns/update\n", quiet);
+    std::printf("sink, every update:  %.1f ns/update (logged=%zu dropped=%llu)\n", crossing,
+                written, static_cast<unsigned long long>(ring.droppedEvents()));
+    std::printf("text report polling: %.1f ns/update (%zu report bytes)\n",
+                report, report_bytes);
+    return written > 0 ? 0 : 1;
+}
@@ -0,0 +1,97 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "arena.hpp"
+
+// Fixed-length row bitmap used as a query result
+class AlnBitmap {
+private:
+    std::vector<uint64_t> words;
+    size_t bits = 0;
+
+public:
+    AlnBitmap() = default;
+    explicit AlnBitmap(size_t row_count, bool all_set = false);
+
+    void set(size_t row) { words[row >> 6] |= uint64_t(1) << (row & 63); }
+    bool test(size_t row) const { return (words[row >> 6] >> (row & 63)) & 1; }
+
+    AlnBitmap& operator&=(const AlnBitmap& other);
+    AlnBitmap& operator|=(const AlnBitmap& other);
+    AlnBitmap& andNot(const AlnBitmap& other);
+
+    size_t count() const;
+    size_t size() const { return bits; }
+    std::vector<size_t> rows() const;
+};
+
+inline AlnBitmap operator&(AlnBitmap a, const AlnBitmap& b) { return a &= b; }
+inline AlnBitmap operator|(AlnBitmap a, const AlnBitmap& b) { return a |= b; }
+
+// Module registry shard (.aln): an optional filename/destination-folder
+// preamble, a header row, then one comma-separated row per vnode.
+// Columns are dictionary-encoded. A distinct value covering at least 1/64
+// of the rows is indexed by a dense bitmap, rarer values by a posting list
+// of rows, so low-cardinality attributes intersect word-at-a-time while
+// unique columns (destination-path) stay O(rows) in memory. Columns holding
+// '+' lists also index each list item the same way.
+class AlnRegistry {
+private:
+    // Rows per key: a bitmap for dense keys, else a posting list
+    struct RowIndex {
+        std::vector<uint32_t> posting_start;  // per key + 1, into posting_rows
+        std::vector<uint32_t> posting_rows;   // ascending rows of sparse keys
+        std::vector<AlnBitmap> bitmaps;       // per dense key, else empty
+    };
+
+    struct Column {
+        std::string name;
+        StringInterner dictionary;
+        std::vector<uint32_t> codes;  // per row
+        RowIndex value_rows;          // keyed by dictionary code
+
+        // Only built when some value is a '+' list
+        bool has_lists = false;
+        StringInterner tokens;
+        RowIndex token_rows;          // keyed by token id
+    };
+
+    std::string file_name;
+    std::string destination_folder;
+    std::vector<std::unique_ptr<Column>> columns;
+    size_t row_count = 0;
+
+    const Column* findColumn(const std::string& column) const;
+    void addRows(const RowIndex& index, uint32_t key, AlnBitmap& out) const;
+
+    friend AlnRegistry loadAlnRegistry(const std::string& alnPath);
+
+public:
+    const std::string& fileName() const { return file_name; }
+    const std::string& destinationFolder() const { return destination_folder; }
+
+    size_t rowCount() const { return row_count; }
+    size_t columnCount() const { return columns.size(); }
+    const std::string& columnName(size_t column) const { return columns[column]->name; }
+
+    // -1 if the registry has no such column
+    int columnIndex(const std::string& column) const;
+
+    std::string_view value(size_t row, size_t column) const;
+
+    // Rows whose attribute equals value exactly
+    AlnBitmap whereEquals(const std::string& column, const std::string& value) const;
+
+    // Rows whose '+'-separated attribute (e.g. compliance "GDPR+EUAI+HIPAA")
+    // lists token
+    AlnBitmap whereContains(const std::string& column, const std::string& token) const;
+
+    // Distinct values of a column, in first-seen order
+    std::vector<std::string_view> distinctValues(const std::string& column) const;
+};
+
+AlnRegistry loadAlnRegistry(const std::string& alnPath);
@@ -0,0 +1,80 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// Fixed-size raw blocks recycled through a free list. Several arenas can
+// share one pool so short-lived owners hand memory back in bulk; trim()
+// frees the idle blocks instead of keeping them for reuse.
+class BlockPool {
+private:
+    size_t block_size;
+    std::vector<std::unique_ptr<char[]>> owned;
+    std::vector<char*> free_blocks;
+
+public:
+    explicit BlockPool(size_t block_bytes = 4096);
+
+    char* acquire();
+    void release(char* block);
+
+    // Free every block currently on the free list; returns blocks freed
+    size_t trim();
+
+    size_t blockSize() const { return block_size; }
+    size_t blocksOwned() const { return owned.size(); }
+    size_t blocksFree() const { return free_blocks.size(); }
+};
+
+// Bump allocator over pool blocks. Nothing is freed individually; reset()
+// returns every block to the pool at once.
+class BumpArena {
+private:
+    BlockPool* pool;
+    std::vector<char*> blocks;
+    std::vector<std::unique_ptr<char[]>> oversized;  // larger than one block
+    size_t used = 0;
+
+public:
+    explicit BumpArena(BlockPool& block_pool) : pool(&block_pool) {}
+    ~BumpArena() { reset(); }
+
+    BumpArena(const BumpArena&) = delete;
+    BumpArena& operator=(const BumpArena&) = delete;
+    BumpArena(BumpArena&& other) noexcept;
+    BumpArena& operator=(BumpArena&& other) noexcept;
+
+    void* allocate(size_t bytes, size_t align = alignof(std::max_align_t));
+
+    // Copy text into the arena; the view stays valid until reset()
+    std::string_view store(std::string_view text);
+
+    void reset();
+};
+
+// Maps strings to dense 32-bit ids in first-seen order, keeping one arena
+// copy of each. Used for stakeholder DIDs and column dictionaries.
+class StringInterner {
+private:
+    BlockPool pool;
+    BumpArena storage;
+    std::unordered_map<std::string_view, uint32_t> ids;
+    std::vector<std::string_view> names;
+
+public:
+    StringInterner() : pool(16384), storage(pool) {}
+
+    StringInterner(const StringInterner&) = delete;
+    StringInterner& operator=(const StringInterner&) = delete;
+
+    uint32_t intern(std::string_view text);
+
+    // Returns false if text has never been interned
+    bool lookup(std::string_view text, uint32_t& id) const;
+
+    std::string_view name(uint32_t id) const { return names[id]; }
+    size_t size() const { return names.size(); }
+};
@@ -0,0 +1,54 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "cyberswarm_kernel.hpp"
+
+// Per-axis linear model: x[t+1] = decay * x[t] + gain * action + disturbance
+struct AxisDynamics {
+    double decay = 1.0;
+    double gain = 1.0;
+};
+
+// Worst-case look-ahead for the kernel's control-barrier condition. Each
+// candidate action is propagated from the kernel's current values over the
+// horizon under every disturbance sample, and is rejected if any trajectory
+// leaves the [min, max] box on any axis at steps 1..horizon.
+//
+// Candidates and disturbances are flattened row-major, one row of
+// getConstraints().size() values each. All (candidate, sample) pairs are
+// laid out as contiguous lanes per axis so the inner step loop vectorizes.
+class BarrierLookahead {
+private:
+    std::vector<AxisDynamics> dynamics;
+    int horizon;
+
+    // Scratch reused across calls; one instance per evaluating thread
+    mutable std::vector<double> state;
+    mutable std::vector<double> drive;
+    mutable std::vector<double> seen_min;
+    mutable std::vector<double> seen_max;
+
+public:
+    explicit BarrierLookahead(size_t axis_count = 7, int horizon_steps = 10);
+
+    void setAxisDynamics(size_t axis, const AxisDynamics& model);
+    void setHorizon(int horizon_steps);
+    int getHorizon() const { return horizon; }
+
+    // One flag per candidate, 1 if every trajectory stays inside the box.
+    // An empty disturbance set evaluates the undisturbed trajectory.
+    std::vector<uint8_t> evaluate(const CyberswarmKernel& kernel,
+                                  const std::vector<double>& candidates,
+                                  const std::vector<double>& disturbances) const;
+
+    bool checkAction(const CyberswarmKernel& kernel,
+                     const std::vector<double>& action,
+                     const std::vector<double>& disturbances) const;
+};
+
+// Worst-case samples for a per-axis disturbance box [-radius, +radius]:
+// one row at +radius and one at -radius. Axes evolve independently, so
+// these two rows bound every constant disturbance in the box when
+// decay >= 0.
+std::vector<double> boxExtremeDisturbances(const std::vector<double>& radius);
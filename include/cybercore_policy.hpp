@@ -1,9 +1,12 @@
 #pragma once
 #include <string>
 #include <vector>
+#include <deque>
 #include <map>
+#include <unordered_map>
 #include <chrono>
 #include "neuro_node.hpp"
+#include "policy_arena.hpp"
 
 enum class StakeholderType {
     CLINICIAN,
@@ -14,6 +17,15 @@ enum class StakeholderType {
     REGULATOR
 };
 
+// HEAP keeps every vote as an owned StakeholderVote inside its decision.
+// ARENA interns identifiers, bump-allocates rationale text per decision and
+// stores votes in pooled slabs; GovernanceDecision::votes is left empty and
+// votes are read back through getVotes().
+enum class PolicyStorage {
+    HEAP,
+    ARENA
+};
+
 struct StakeholderVote {
     StakeholderType type;
     std::string identifier;  // DID or other ID
@@ -28,6 +40,7 @@ struct GovernanceDecision {
     std::vector<StakeholderVote> votes;
     double consensus_threshold = 0.7;  // 70% default
     bool approved;
+    bool finalized = false;
     std::chrono::system_clock::time_point decision_time;
     
     // NeuroRights tags
@@ -36,12 +49,47 @@ struct GovernanceDecision {
 
 class CybercorePolicy {
 private:
-    std::vector<GovernanceDecision> decisions;
+    // Compact vote record used in ARENA mode (trivially destructible)
+    struct ArenaVote {
+        uint32_t identifier_id;
+        StakeholderType type;
+        bool approval;
+        std::chrono::system_clock::time_point timestamp;
+        std::string_view rationale;
+    };
+
+    struct ArenaVotes {
+        ChunkedSlab<ArenaVote> votes;
+        BumpArena rationale_text;
+
+        explicit ArenaVotes(BlockPool& text_pool) : rationale_text(text_pool) {}
+    };
+
+    PolicyStorage storage;
+
+    // Pools are declared before the per-decision storage that draws on them
+    StringInterner identifiers;
+    BlockPool vote_pool{4096};
+    BlockPool text_pool{4096};
+
+    std::deque<GovernanceDecision> decisions;
+    std::deque<ArenaVotes> arena_votes;  // parallel to decisions in ARENA mode
+    std::unordered_map<std::string, size_t> decision_index;  // id -> position
     std::map<StakeholderType, int> stakeholder_weights;
     double current_consensus_threshold = 0.7;
+
+    // Totals carried over from archived decisions
+    int archived_decisions = 0;
+    int archived_approved = 0;
+    int archived_tagged = 0;
+    std::map<std::string, int> archived_tag_counts;
     
 public:
-    CybercorePolicy();
+    explicit CybercorePolicy(PolicyStorage storage_mode = PolicyStorage::HEAP);
+    ~CybercorePolicy();
+
+    CybercorePolicy(const CybercorePolicy&) = delete;
+    CybercorePolicy& operator=(const CybercorePolicy&) = delete;
     
     // Propose a new decision
     std::string proposeDecision(const std::string& description, 
@@ -63,6 +111,20 @@ public:
     // Get decision by ID
     const GovernanceDecision* getDecision(const std::string& decision_id) const;
     
+    // Get votes cast on a decision (materialized from slabs in ARENA mode)
+    std::vector<StakeholderVote> getVotes(const std::string& decision_id) const;
+    
+    // Drop finalized decisions from the live set, keeping their totals for
+    // compliance reporting. In ARENA mode their vote slabs and rationale
+    // blocks go back to the pools in one pass. Returns decisions archived.
+    size_t archiveFinalizedDecisions();
+    
+    // Free pooled vote and rationale blocks left idle by archiving (ARENA
+    // mode); returns bytes handed back to the allocator
+    size_t releaseUnusedMemory();
+    
+    PolicyStorage getStorageMode() const { return storage; }
+    
     // Get all decisions with given neurorights tag
     std::vector<GovernanceDecision> getDecisionsByTag(const std::string& tag) const;
     
@@ -87,8 +149,11 @@ public:
     ComplianceReport generateComplianceReport() const;
     
 private:
+    static constexpr size_t npos = static_cast<size_t>(-1);
+    
+    size_t findDecisionIndex(const std::string& decision_id) const;
     GovernanceDecision* findDecision(const std::string& decision_id);
     const GovernanceDecision* findDecision(const std::string& decision_id) const;
-    double calculateApprovalRate(const GovernanceDecision& decision) const;
+    double calculateApprovalRate(size_t index) const;
     bool checkNeurorightsTags(const std::vector<std::string>& tags) const;
 };
@@ -2,6 +2,7 @@
 #include <vector>
 #include <string>
 #include "neuro_node.hpp"
+#include "violation_events.hpp"
 
 struct SafetyConstraint {
     std::string axis;  // intensity, duty, load, power, neuromod_amplitude, cognitive_load, legal_complexity
@@ -15,6 +16,7 @@ class CyberswarmKernel {
 private:
     std::vector<SafetyConstraint> constraints;
     const int AXIS_COUNT = 7;
+    ViolationEventRing* event_sink = nullptr;  // not owned
     
 public:
     CyberswarmKernel();
@@ -22,6 +24,10 @@ public:
     // Load constraints from neuro nodes
     void loadConstraints(const std::vector<NeuroNode>& nodes);
     
+    // Take axis upper bounds from the shard (MaxCognitiveLoadIndex for
+    // cognitive_load, GatewayPowerDraw for power); other axes keep defaults
+    void loadBounds(const std::vector<NeuroNode>& nodes);
+    
     // Check if a proposed action violates constraints
     bool checkViability(const std::vector<double>& proposed_action) const;
     
@@ -31,6 +37,14 @@ public:
     // Update constraint values (for simulation/telemetry)
     void updateConstraint(const std::string& axis, double value);
     
+    // Same, addressed by index into getConstraints() (no name lookup)
+    void updateConstraint(size_t axis_id, double value);
+    
+    // Emit a ViolationEvent into sink on every boundary crossing made by
+    // updateConstraint. The kernel must be the ring's only producer; pass
+    // nullptr to detach.
+    void attachEventSink(ViolationEventRing* sink) { event_sink = sink; }
+    
     // Calculate safety margin (0-1, higher is safer)
     double calculateSafetyMargin() const;
     
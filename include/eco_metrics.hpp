@@ -1,7 +1,11 @@
 #pragma once
+#include <cstdint>
+#include <string>
 #include <vector>
 #include "neuro_node.hpp"
 
+class NodeTimeIndex;
+
 struct EcoSummary {
     double avgEcoImpactScore;
     double ecoImpactScoreWater;
@@ -11,3 +15,9 @@ struct EcoSummary {
 
 std::vector<NeuroNode> loadNeurostackEcoShard(const std::string& csvPath);
 EcoSummary computeEcoSummary(const std::vector<NeuroNode>& nodes);
+
+// Summary over nodes whose window overlaps [fromDay, toDay] (days since
+// 1970-01-01, inclusive); windows must index the same node vector
+EcoSummary computeEcoSummary(const std::vector<NeuroNode>& nodes,
+                             const NodeTimeIndex& windows,
+                             int32_t fromDay, int32_t toDay);
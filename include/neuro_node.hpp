@@ -1,4 +1,5 @@
 #pragma once
+#include <cstdint>
 #include <string>
 
 struct NeuroNode {
@@ -11,6 +12,10 @@ struct NeuroNode {
     std::string unit;
     double value;
     std::string window;
+    // window parsed at load time: inclusive days since 1970-01-01,
+    // start > end when the window could not be parsed
+    int32_t windowStartDay = 0;
+    int32_t windowEndDay = -1;
     double ecoImpactScore;
     std::string notes;
 };
@@ -0,0 +1,106 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+#include "arena.hpp"
+
+// Singly linked chunks of T drawn from a shared BlockPool. Appending never
+// moves existing elements. The owner must call release() before dropping it.
+template <typename T>
+class ChunkedSlab {
+private:
+    struct Chunk {
+        Chunk* next;
+        uint32_t count;
+    };
+
+    Chunk* head = nullptr;
+    Chunk* tail = nullptr;
+    size_t total = 0;
+
+    static size_t headerBytes() {
+        return (sizeof(Chunk) + alignof(T) - 1) / alignof(T) * alignof(T);
+    }
+    static size_t capacity(const BlockPool& pool) {
+        return (pool.blockSize() - headerBytes()) / sizeof(T);
+    }
+    static T* items(Chunk* chunk) {
+        return reinterpret_cast<T*>(reinterpret_cast<char*>(chunk) + headerBytes());
+    }
+    static const T* items(const Chunk* chunk) {
+        return reinterpret_cast<const T*>(
+            reinterpret_cast<const char*>(chunk) + headerBytes());
+    }
+
+public:
+    ChunkedSlab() = default;
+    ChunkedSlab(const ChunkedSlab&) = delete;
+    ChunkedSlab& operator=(const ChunkedSlab&) = delete;
+    ChunkedSlab(ChunkedSlab&& other) noexcept
+        : head(other.head), tail(other.tail), total(other.total) {
+        other.head = other.tail = nullptr;
+        other.total = 0;
+    }
+    ChunkedSlab& operator=(ChunkedSlab&& other) noexcept {
+        std::swap(head, other.head);
+        std::swap(tail, other.tail);
+        std::swap(total, other.total);
+        return *this;
+    }
+
+    void push_back(BlockPool& pool, const T& value) {
+        if (!tail || tail->count == capacity(pool)) {
+            auto* chunk = reinterpret_cast<Chunk*>(pool.acquire());
+            chunk->next = nullptr;
+            chunk->count = 0;
+            if (tail) {
+                tail->next = chunk;
+            } else {
+                head = chunk;
+            }
+            tail = chunk;
+        }
+        new (items(tail) + tail->count) T(value);
+        ++tail->count;
+        ++total;
+    }
+
+    template <typename Fn>
+    void forEach(Fn&& fn) const {
+        for (const Chunk* chunk = head; chunk; chunk = chunk->next) {
+            const T* values = items(chunk);
+            for (uint32_t i = 0; i < chunk->count; ++i) {
+                fn(values[i]);
+            }
+        }
+    }
+
+    // Stops at the first element for which pred returns true
+    template <typename Pred>
+    bool any(Pred&& pred) const {
+        for (const Chunk* chunk = head; chunk; chunk = chunk->next) {
+            const T* values = items(chunk);
+            for (uint32_t i = 0; i < chunk->count; ++i) {
+                if (pred(values[i])) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    // Hands every chunk back to the pool; T must be trivially destructible
+    void release(BlockPool& pool) {
+        while (head) {
+            Chunk* next = head->next;
+            pool.release(reinterpret_cast<char*>(head));
+            head = next;
+        }
+        tail = nullptr;
+        total = 0;
+    }
+
+    size_t size() const { return total; }
+    bool empty() const { return total == 0; }
+};
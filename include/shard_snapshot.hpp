@@ -0,0 +1,127 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "neuro_node.hpp"
+#include "eco_metrics.hpp"
+#include "cyberswarm_kernel.hpp"
+
+// Immutable view of one parsed shard. Never modified after publication.
+struct ShardSnapshot {
+    uint64_t version;
+    std::vector<NeuroNode> nodes;
+    EcoSummary summary;
+    CyberswarmKernel kernel;  // axis bounds taken from the shard
+    double consensus_threshold = 0.7;  // GovOS ConsensusThreshold
+};
+
+// Parse a shard and derive its summary, kernel bounds and consensus
+// threshold
+std::unique_ptr<ShardSnapshot> buildShardSnapshot(const std::string& csvPath,
+                                                  uint64_t version);
+
+// Publishes snapshots through an atomic pointer and reclaims replaced ones
+// with epoch-based reclamation. Readers only touch atomics: a ReadGuard
+// claims a reader slot, records the global epoch and loads the pointer.
+// A retired snapshot is freed once every active slot has moved past the
+// epoch it was retired in.
+class SnapshotDomain {
+public:
+    static constexpr size_t kReaderSlots = 128;
+
+private:
+    struct alignas(64) ReaderSlot {
+        std::atomic<bool> claimed{false};
+        std::atomic<uint64_t> epoch{0};  // 0 when not reading
+    };
+
+    ReaderSlot slots[kReaderSlots];
+    std::atomic<uint64_t> global_epoch{1};
+    std::atomic<const ShardSnapshot*> current{nullptr};
+
+    // Writer side only
+    std::mutex retire_mutex;
+    std::vector<std::pair<uint64_t, const ShardSnapshot*>> retired;
+
+    ReaderSlot* claimSlot();
+
+public:
+    SnapshotDomain() = default;
+    ~SnapshotDomain();
+
+    SnapshotDomain(const SnapshotDomain&) = delete;
+    SnapshotDomain& operator=(const SnapshotDomain&) = delete;
+
+    class ReadGuard {
+    private:
+        ReaderSlot* slot;
+        const ShardSnapshot* snapshot;
+
+    public:
+        explicit ReadGuard(SnapshotDomain& domain);
+        ~ReadGuard();
+
+        ReadGuard(const ReadGuard&) = delete;
+        ReadGuard& operator=(const ReadGuard&) = delete;
+
+        // Null until the first snapshot is published
+        const ShardSnapshot* get() const { return snapshot; }
+        const ShardSnapshot* operator->() const { return snapshot; }
+    };
+
+    // Swap in a new snapshot and retire the previous one
+    void publish(std::unique_ptr<ShardSnapshot> snapshot);
+
+    // Free retired snapshots no reader can still see; returns count freed
+    size_t reclaim();
+
+    size_t pendingReclaim();
+};
+
+// Watches a shard file (inotify on Linux, mtime polling elsewhere) and
+// republishes a fresh snapshot after each change. Parsing happens on the
+// watcher thread; a shard that fails to parse leaves the previous snapshot
+// in place.
+class ShardWatcher {
+private:
+    std::string shard_path;
+    SnapshotDomain domain;
+    std::thread worker;
+    std::atomic<bool> running{false};
+    std::atomic<uint64_t> next_version{1};
+    std::atomic<uint64_t> failed_reloads{0};
+    int notify_fd = -1;  // inotify descriptor while started
+
+    std::mutex error_mutex;
+    std::string last_error;
+
+    void watchLoop();
+    void reload();
+
+public:
+    // Loads the shard synchronously; throws if the initial load fails
+    explicit ShardWatcher(const std::string& csvPath);
+    ~ShardWatcher();
+
+    ShardWatcher(const ShardWatcher&) = delete;
+    ShardWatcher& operator=(const ShardWatcher&) = delete;
+
+    // Changes written after start() returns trigger a reload
+    void start();
+    void stop();
+
+    // Pin the current snapshot for the lifetime of the guard
+    SnapshotDomain::ReadGuard read() { return SnapshotDomain::ReadGuard(domain); }
+
+    // Reparse and publish immediately, bypassing file notifications
+    void reloadNow() { reload(); }
+
+    uint64_t failedReloads() const { return failed_reloads.load(); }
+    std::string lastError();
+};
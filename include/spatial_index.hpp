@@ -0,0 +1,67 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+#include "neuro_node.hpp"
+
+struct GeoBounds {
+    double min_latitude;
+    double min_longitude;
+    double max_latitude;
+    double max_longitude;
+};
+
+struct NearestNodeMatch {
+    size_t node_index;     // query node (e.g. BCIIngress)
+    size_t nearest_index;  // closest indexed node, or SIZE_MAX if none
+    double distance_km;
+};
+
+// Uniform lat/lon grid over a node table, stored cell-major (CSR) so each
+// cell's coordinates sit contiguously. Queries return indices into the
+// vector the index was built from. Longitudes are in [-180, 180]; radius
+// and nearest queries follow great circles across the antimeridian,
+// bounding-box queries take the box literally.
+class NodeSpatialIndex {
+private:
+    double cell_degrees = 1.0;
+    double origin_latitude = 0.0;
+    double origin_longitude = 0.0;
+    int columns = 0;
+    int rows = 0;
+
+    std::vector<uint32_t> cell_start;  // rows * columns + 1 offsets
+    std::vector<double> entry_latitude;
+    std::vector<double> entry_longitude;
+    std::vector<size_t> entry_node;
+
+public:
+    NodeSpatialIndex() = default;
+
+    // cell_size_degrees <= 0 picks a size giving a few nodes per cell.
+    // Nodes rejected by include are left out of the index.
+    explicit NodeSpatialIndex(const std::vector<NeuroNode>& nodes,
+                              double cell_size_degrees = 0.0,
+                              const std::function<bool(const NeuroNode&)>& include = nullptr);
+
+    // Nodes within radius_km (great-circle) of the point
+    std::vector<size_t> queryRadius(double latitude, double longitude,
+                                    double radius_km) const;
+
+    // Nodes inside an inclusive lat/lon box
+    std::vector<size_t> queryBoundingBox(const GeoBounds& bounds) const;
+
+    // Closest indexed node to the point; false if the index is empty
+    bool nearest(double latitude, double longitude,
+                 size_t& node_index, double& distance_km) const;
+
+    size_t size() const { return entry_node.size(); }
+    double cellDegrees() const { return cell_degrees; }
+};
+
+// Great-circle distance on a spherical Earth
+double haversineKm(double lat1, double lon1, double lat2, double lon2);
+
+// For every BCIIngress node, the closest EcoLink node in the same table
+std::vector<NearestNodeMatch> nearestEcoLinkForIngress(const std::vector<NeuroNode>& nodes);
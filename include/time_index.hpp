@@ -0,0 +1,38 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "neuro_node.hpp"
+
+// Parse "YYYY-MM-DD" into days since 1970-01-01; rejects impossible dates
+// such as 2026-02-31 or 2025-02-29
+bool parseIsoDay(const std::string& text, int32_t& day);
+
+// Parse a "start/end" window into inclusive day bounds
+bool parseWindowDays(const std::string& window, int32_t& start_day, int32_t& end_day);
+
+// Static interval tree over node windows. Intervals are sorted by start
+// and laid out as an implicit binary tree whose inner slots carry the
+// maximum end of their subtree, so stabbing and overlap queries cost
+// O(log n + matches). Nodes with unparsed windows are not indexed.
+class NodeTimeIndex {
+private:
+    std::vector<int32_t> starts;
+    std::vector<int32_t> ends;      // exclusive
+    std::vector<int32_t> max_ends;  // per implicit tree slot
+    std::vector<size_t> node_of;
+    int max_level = -1;
+
+public:
+    NodeTimeIndex() = default;
+    explicit NodeTimeIndex(const std::vector<NeuroNode>& nodes);
+
+    // Nodes whose window contains day
+    std::vector<size_t> activeOn(int32_t day) const;
+
+    // Nodes whose window overlaps the inclusive range [from_day, to_day]
+    std::vector<size_t> overlapping(int32_t from_day, int32_t to_day) const;
+
+    size_t size() const { return starts.size(); }
+};
@@ -0,0 +1,61 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+enum class ViolationEventKind : uint8_t {
+    VIOLATION,  // axis value left its [min, max] range
+    RECOVERY    // axis value returned inside its range
+};
+
+// Fixed-size binary record emitted on every boundary crossing. Written to
+// logs as raw bytes, so the layout is explicit and padding is always zero.
+struct ViolationEvent {
+    int64_t timestamp_ns;  // steady_clock
+    double value;
+    double bound;          // the bound crossed (min or max)
+    uint8_t axis_id;       // index into CyberswarmKernel::getConstraints()
+    ViolationEventKind kind;
+    uint8_t reserved[6];   // zero
+};
+static_assert(sizeof(ViolationEvent) == 32, "ViolationEvent is a 32-byte log record");
+
+// Single-producer/single-consumer ring with storage allocated up front.
+// The producer never blocks: when the ring is full the event is dropped
+// and counted.
+class ViolationEventRing {
+private:
+    std::vector<ViolationEvent> buffer;
+    size_t mask;
+
+    alignas(64) std::atomic<size_t> head{0};  // next slot to write
+    size_t cached_tail = 0;                   // producer's view of tail
+    alignas(64) std::atomic<size_t> tail{0};  // next slot to read
+    size_t cached_head = 0;                   // consumer's view of head
+    alignas(64) std::atomic<uint64_t> dropped{0};
+
+public:
+    // Capacity is rounded up to a power of two
+    explicit ViolationEventRing(size_t capacity = 4096);
+
+    ViolationEventRing(const ViolationEventRing&) = delete;
+    ViolationEventRing& operator=(const ViolationEventRing&) = delete;
+
+    // Producer side
+    bool tryPush(const ViolationEvent& event);
+
+    // Consumer side: copy up to max_events into out, returns count
+    size_t drain(ViolationEvent* out, size_t max_events);
+
+    size_t capacity() const { return buffer.size(); }
+    uint64_t droppedEvents() const { return dropped.load(std::memory_order_relaxed); }
+};
+
+// Drain the ring into a binary log in batches; returns events written
+size_t drainViolationEventsToFile(ViolationEventRing& ring, std::FILE* out);
+
+// Human-readable line for one event, for use off the hot path
+std::string formatViolationEvent(const ViolationEvent& event, const std::string& axis);
@@ -0,0 +1,297 @@
+#include "aln_registry.hpp"
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+
+// Split one line on commas into views; a trailing '\r' is dropped
+void splitFields(std::string_view line, std::vector<std::string_view>& fields) {
+    fields.clear();
+    if (!line.empty() && line.back() == '\r') {
+        line.remove_suffix(1);
+    }
+    size_t start = 0;
+    while (true) {
+        size_t comma = line.find(',', start);
+        if (comma == std::string_view::npos) {
+            fields.push_back(line.substr(start));
+            return;
+        }
+        fields.push_back(line.substr(start, comma - start));
+        start = comma + 1;
+    }
+}
+
+bool nextLine(std::string_view text, size_t& pos, std::string_view& line) {
+    if (pos >= text.size()) {
+        return false;
+    }
+    size_t end = text.find('\n', pos);
+    if (end == std::string_view::npos) {
+        end = text.size();
+    }
+    line = text.substr(pos, end - pos);
+    pos = end + 1;
+    return true;
+}
+
+// Items of a '+'-separated list such as "GDPR+EUAI+HIPAA"
+template <typename Fn>
+void forEachListItem(std::string_view value, Fn&& fn) {
+    size_t start = 0;
+    while (true) {
+        size_t plus = value.find('+', start);
+        if (plus == std::string_view::npos) {
+            fn(value.substr(start));
+            return;
+        }
+        fn(value.substr(start, plus - start));
+        start = plus + 1;
+    }
+}
+
+}  // namespace
+
+AlnBitmap::AlnBitmap(size_t row_count, bool all_set)
+    : words((row_count + 63) / 64, all_set ? ~uint64_t(0) : 0), bits(row_count) {
+    if (all_set && (row_count & 63)) {
+        words.back() = (uint64_t(1) << (row_count & 63)) - 1;
+    }
+}
+
+AlnBitmap& AlnBitmap::operator&=(const AlnBitmap& other) {
+    for (size_t i = 0; i < words.size(); ++i) {
+        words[i] &= other.words[i];
+    }
+    return *this;
+}
+
+AlnBitmap& AlnBitmap::operator|=(const AlnBitmap& other) {
+    for (size_t i = 0; i < words.size(); ++i) {
+        words[i] |= other.words[i];
+    }
+    return *this;
+}
+
+AlnBitmap& AlnBitmap::andNot(const AlnBitmap& other) {
+    for (size_t i = 0; i < words.size(); ++i) {
+        words[i] &= ~other.words[i];
+    }
+    return *this;
+}
+
+size_t AlnBitmap::count() const {
+    size_t total = 0;
+    for (uint64_t word : words) {
+        total += __builtin_popcountll(word);
+    }
+    return total;
+}
+
+std::vector<size_t> AlnBitmap::rows() const {
+    std::vector<size_t> result;
+    for (size_t i = 0; i < words.size(); ++i) {
+        uint64_t word = words[i];
+        while (word) {
+            result.push_back(i * 64 + __builtin_ctzll(word));
+            word &= word - 1;
+        }
+    }
+    return result;
+}
+
+const AlnRegistry::Column* AlnRegistry::findColumn(const std::string& column) const {
+    int index = columnIndex(column);
+    return index < 0 ? nullptr : columns[index].get();
+}
+
+int AlnRegistry::columnIndex(const std::string& column) const {
+    for (size_t i = 0; i < columns.size(); ++i) {
+        if (columns[i]->name == column) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+std::string_view AlnRegistry::value(size_t row, size_t column) const {
+    const auto& col = *columns[column];
+    return col.dictionary.name(col.codes[row]);
+}
+
+void AlnRegistry::addRows(const RowIndex& index, uint32_t key, AlnBitmap& out) const {
+    if (index.bitmaps[key].size() != 0) {
+        out |= index.bitmaps[key];
+        return;
+    }
+    for (uint32_t i = index.posting_start[key]; i < index.posting_start[key + 1]; ++i) {
+        out.set(index.posting_rows[i]);
+    }
+}
+
+AlnBitmap AlnRegistry::whereEquals(const std::string& column, const std::string& value) const {
+    AlnBitmap result(row_count);
+    const Column* col = findColumn(column);
+    uint32_t code;
+    if (col && col->dictionary.lookup(value, code)) {
+        addRows(col->value_rows, code, result);
+    }
+    return result;
+}
+
+AlnBitmap AlnRegistry::whereContains(const std::string& column, const std::string& token) const {
+    AlnBitmap result(row_count);
+    const Column* col = findColumn(column);
+    uint32_t id;
+    if (!col) {
+        return result;
+    }
+    if (col->has_lists) {
+        if (col->tokens.lookup(token, id)) {
+            addRows(col->token_rows, id, result);
+        }
+    } else if (col->dictionary.lookup(token, id)) {
+        // No lists in this column: each value is its only token
+        addRows(col->value_rows, id, result);
+    }
+    return result;
+}
+
+std::vector<std::string_view> AlnRegistry::distinctValues(const std::string& column) const {
+    std::vector<std::string_view> values;
+    const Column* col = findColumn(column);
+    if (col) {
+        for (uint32_t code = 0; code < col->dictionary.size(); ++code) {
+            values.push_back(col->dictionary.name(code));
+        }
+    }
+    return values;
+}
+
+AlnRegistry loadAlnRegistry(const std::string& alnPath) {
+    std::ifstream file(alnPath, std::ios::binary);
+    if (!file.is_open()) {
+        throw std::runtime_error("Unable to open ALN registry: " + alnPath);
+    }
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    const std::string contents = buffer.str();
+    const std::string_view text(contents);
+
+    AlnRegistry registry;
+    std::vector<std::string_view> fields;
+    std::string_view line;
+    size_t pos = 0;
+
+    // Preamble, then the header row
+    while (nextLine(text, pos, line)) {
+        splitFields(line, fields);
+        if (fields.size() == 2 && fields[0] == "filename") {
+            registry.file_name = std::string(fields[1]);
+        } else if (fields.size() == 2 && fields[0] == "destination-folder") {
+            registry.destination_folder = std::string(fields[1]);
+        } else if (!line.empty() && line != "\r") {
+            for (auto name : fields) {
+                auto col = std::make_unique<AlnRegistry::Column>();
+                col->name = std::string(name);
+                registry.columns.push_back(std::move(col));
+            }
+            break;
+        }
+    }
+    if (registry.columns.empty()) {
+        return registry;
+    }
+    const size_t expected_rows = pos < text.size()
+        ? std::count(text.begin() + pos, text.end(), '\n') + 1 : 0;
+    for (auto& col : registry.columns) {
+        col->codes.reserve(expected_rows);
+    }
+
+    while (nextLine(text, pos, line)) {
+        splitFields(line, fields);
+        if (fields.size() != registry.columns.size()) continue;
+
+        registry.row_count++;
+        for (size_t c = 0; c < fields.size(); ++c) {
+            auto& col = *registry.columns[c];
+            col.codes.push_back(col.dictionary.intern(fields[c]));
+        }
+    }
+
+    // Dense keys get a bitmap for word-at-a-time intersection, the rest a
+    // posting list laid out by counting sort. A row carries the keys of its
+    // value code, given as a CSR map from code to keys.
+    const size_t rows = registry.row_count;
+    auto buildRowIndex = [rows](AlnRegistry::RowIndex& index, const std::vector<uint32_t>& codes,
+                                size_t keys, const std::vector<uint32_t>& key_start,
+                                const std::vector<uint32_t>& key_ids) {
+        std::vector<uint32_t> counts(keys, 0);
+        for (uint32_t code : codes) {
+            for (uint32_t k = key_start[code]; k < key_start[code + 1]; ++k) {
+                counts[key_ids[k]]++;
+            }
+        }
+
+        index.bitmaps.resize(keys);
+        index.posting_start.assign(keys + 1, 0);
+        for (size_t key = 0; key < keys; ++key) {
+            bool dense = static_cast<size_t>(counts[key]) * 64 >= rows;
+            if (dense) {
+                index.bitmaps[key] = AlnBitmap(rows);
+            }
+            index.posting_start[key + 1] = index.posting_start[key] + (dense ? 0 : counts[key]);
+        }
+
+        index.posting_rows.resize(index.posting_start[keys]);
+        std::vector<uint32_t> cursor(index.posting_start.begin(), index.posting_start.end() - 1);
+        for (size_t row = 0; row < rows; ++row) {
+            uint32_t code = codes[row];
+            for (uint32_t k = key_start[code]; k < key_start[code + 1]; ++k) {
+                uint32_t key = key_ids[k];
+                if (index.bitmaps[key].size() != 0) {
+                    index.bitmaps[key].set(row);
+                } else {
+                    index.posting_rows[cursor[key]++] = static_cast<uint32_t>(row);
+                }
+            }
+        }
+    };
+
+    std::vector<uint32_t> key_start, key_ids;
+    for (auto& col : registry.columns) {
+        const size_t values = col->dictionary.size();
+        key_start.resize(values + 1);
+        key_ids.resize(values);
+        for (uint32_t code = 0; code < values; ++code) {
+            key_start[code] = key_ids[code] = code;
+        }
+        key_start[values] = static_cast<uint32_t>(values);
+        buildRowIndex(col->value_rows, col->codes, values, key_start, key_ids);
+
+        // Split '+' lists once per distinct value so whereContains is a
+        // token lookup rather than a dictionary scan
+        for (uint32_t code = 0; code < values && !col->has_lists; ++code) {
+            col->has_lists = col->dictionary.name(code).find('+') != std::string_view::npos;
+        }
+        if (!col->has_lists) {
+            continue;
+        }
+        key_ids.clear();
+        for (uint32_t code = 0; code < values; ++code) {
+            key_start[code] = static_cast<uint32_t>(key_ids.size());
+            forEachListItem(col->dictionary.name(code), [&](std::string_view item) {
+                key_ids.push_back(col->tokens.intern(item));
+            });
+            // "A+A" lists A once
+            auto first = key_ids.begin() + key_start[code];
+            std::sort(first, key_ids.end());
+            key_ids.erase(std::unique(first, key_ids.end()), key_ids.end());
+        }
+        key_start[values] = static_cast<uint32_t>(key_ids.size());
+        buildRowIndex(col->token_rows, col->codes, col->tokens.size(), key_start, key_ids);
+    }
+    return registry;
+}
@@ -0,0 +1,121 @@
+#include "arena.hpp"
+#include <algorithm>
+#include <cstring>
+
+BlockPool::BlockPool(size_t block_bytes)
+    : block_size(block_bytes) {}
+
+char* BlockPool::acquire() {
+    if (free_blocks.empty()) {
+        owned.emplace_back(new char[block_size]);
+        return owned.back().get();
+    }
+    char* block = free_blocks.back();
+    free_blocks.pop_back();
+    return block;
+}
+
+void BlockPool::release(char* block) {
+    free_blocks.push_back(block);
+}
+
+size_t BlockPool::trim() {
+    if (free_blocks.empty()) {
+        return 0;
+    }
+    std::sort(free_blocks.begin(), free_blocks.end());
+    owned.erase(std::remove_if(owned.begin(), owned.end(),
+        [&](const std::unique_ptr<char[]>& block) {
+            return std::binary_search(free_blocks.begin(), free_blocks.end(), block.get());
+        }), owned.end());
+    size_t freed = free_blocks.size();
+    free_blocks.clear();
+    return freed;
+}
+
+BumpArena::BumpArena(BumpArena&& other) noexcept
+    : pool(other.pool),
+      blocks(std::move(other.blocks)),
+      oversized(std::move(other.oversized)),
+      used(other.used) {
+    other.blocks.clear();
+    other.oversized.clear();
+    other.used = 0;
+}
+
+BumpArena& BumpArena::operator=(BumpArena&& other) noexcept {
+    if (this != &other) {
+        reset();
+        pool = other.pool;
+        blocks = std::move(other.blocks);
+        oversized = std::move(other.oversized);
+        used = other.used;
+        other.blocks.clear();
+        other.oversized.clear();
+        other.used = 0;
+    }
+    return *this;
+}
+
+void* BumpArena::allocate(size_t bytes, size_t align) {
+    const size_t block_size = pool->blockSize();
+    if (bytes + align > block_size) {
+        oversized.emplace_back(new char[bytes + align]);
+        auto addr = reinterpret_cast<uintptr_t>(oversized.back().get());
+        return reinterpret_cast<void*>((addr + align - 1) & ~(uintptr_t)(align - 1));
+    }
+
+    if (!blocks.empty()) {
+        auto base = reinterpret_cast<uintptr_t>(blocks.back());
+        uintptr_t aligned = (base + used + align - 1) & ~(uintptr_t)(align - 1);
+        if (aligned + bytes <= base + block_size) {
+            used = aligned + bytes - base;
+            return reinterpret_cast<void*>(aligned);
+        }
+    }
+
+    blocks.push_back(pool->acquire());
+    auto base = reinterpret_cast<uintptr_t>(blocks.back());
+    uintptr_t aligned = (base + align - 1) & ~(uintptr_t)(align - 1);
+    used = aligned + bytes - base;
+    return reinterpret_cast<void*>(aligned);
+}
+
+std::string_view BumpArena::store(std::string_view text) {
+    if (text.empty()) {
+        return {};
+    }
+    auto* dst = static_cast<char*>(allocate(text.size(), 1));
+    std::memcpy(dst, text.data(), text.size());
+    return std::string_view(dst, text.size());
+}
+
+void BumpArena::reset() {
+    for (char* block : blocks) {
+        pool->release(block);
+    }
+    blocks.clear();
+    oversized.clear();
+    used = 0;
+}
+
+uint32_t StringInterner::intern(std::string_view text) {
+    auto it = ids.find(text);
+    if (it != ids.end()) {
+        return it->second;
+    }
+    std::string_view stored = storage.store(text);
+    auto id = static_cast<uint32_t>(names.size());
+    names.push_back(stored);
+    ids.emplace(stored, id);
+    return id;
+}
+
+bool StringInterner::lookup(std::string_view text, uint32_t& id) const {
+    auto it = ids.find(text);
+    if (it == ids.end()) {
+        return false;
+    }
+    id = it->second;
+    return true;
+}
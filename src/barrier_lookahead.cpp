@@ -0,0 +1,148 @@
+#include "barrier_lookahead.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+
+// Lanes processed per block; keeps the per-axis scratch in L1/L2
+const size_t kLaneBlock = 2048;
+
+// Lane loops touch disjoint scratch arrays; tell the compiler so it does
+// not fall back to scalar code behind runtime alias checks
+#if defined(__clang__)
+#define PHOENIX_VECTORIZE_LOOP _Pragma("clang loop vectorize(enable)")
+#elif defined(__GNUC__)
+#define PHOENIX_VECTORIZE_LOOP _Pragma("GCC ivdep")
+#else
+#define PHOENIX_VECTORIZE_LOOP
+#endif
+
+// One axis over all lanes of a block: track the running min/max of
+// x[t+1] = decay * x[t] + drive for t = 1..horizon
+void propagateLanes(double* __restrict x, const double* __restrict drive,
+                    double* __restrict seen_min, double* __restrict seen_max,
+                    size_t lanes, int horizon, double decay, double x0,
+                    double lo, double hi) {
+    PHOENIX_VECTORIZE_LOOP
+    for (size_t l = 0; l < lanes; ++l) {
+        x[l] = x0;
+        seen_min[l] = hi;
+        seen_max[l] = lo;
+    }
+    for (int t = 0; t < horizon; ++t) {
+        PHOENIX_VECTORIZE_LOOP
+        for (size_t l = 0; l < lanes; ++l) {
+            double next = decay * x[l] + drive[l];
+            x[l] = next;
+            seen_min[l] = next < seen_min[l] ? next : seen_min[l];
+            seen_max[l] = next > seen_max[l] ? next : seen_max[l];
+        }
+    }
+}
+
+}  // namespace
+
+BarrierLookahead::BarrierLookahead(size_t axis_count, int horizon_steps)
+    : dynamics(axis_count), horizon(std::max(1, horizon_steps)) {}
+
+void BarrierLookahead::setAxisDynamics(size_t axis, const AxisDynamics& model) {
+    if (axis < dynamics.size()) {
+        dynamics[axis] = model;
+    }
+}
+
+void BarrierLookahead::setHorizon(int horizon_steps) {
+    horizon = std::max(1, horizon_steps);
+}
+
+std::vector<uint8_t> BarrierLookahead::evaluate(
+    const CyberswarmKernel& kernel,
+    const std::vector<double>& candidates,
+    const std::vector<double>& disturbances) const {
+
+    const auto& constraints = kernel.getConstraints();
+    const size_t axes = constraints.size();
+    if (axes != dynamics.size()) {
+        throw std::invalid_argument("Look-ahead axis count does not match kernel");
+    }
+    if (candidates.size() % axes != 0 || disturbances.size() % axes != 0) {
+        throw std::invalid_argument("Look-ahead rows must have one value per axis");
+    }
+
+    const size_t candidate_count = candidates.size() / axes;
+    const bool undisturbed = disturbances.empty();
+    const size_t samples = undisturbed ? 1 : disturbances.size() / axes;
+    std::vector<uint8_t> accepted(candidate_count, 1);
+    if (candidate_count == 0) {
+        return accepted;
+    }
+
+    const size_t block_candidates = std::max<size_t>(1, kLaneBlock / samples);
+    const size_t max_lanes = block_candidates * samples;
+    state.resize(max_lanes);
+    drive.resize(max_lanes);
+    seen_min.resize(max_lanes);
+    seen_max.resize(max_lanes);
+
+    for (size_t c0 = 0; c0 < candidate_count; c0 += block_candidates) {
+        const size_t c1 = std::min(candidate_count, c0 + block_candidates);
+        const size_t lanes = (c1 - c0) * samples;
+
+        for (size_t axis = 0; axis < axes; ++axis) {
+            const double decay = dynamics[axis].decay;
+            const double gain = dynamics[axis].gain;
+            const double x0 = constraints[axis].current_value;
+            const double lo = constraints[axis].min_value;
+            const double hi = constraints[axis].max_value;
+
+            // Lane (c, s) is driven by gain * u[c] + d[s] at every step
+            for (size_t c = c0; c < c1; ++c) {
+                const double pushed = gain * candidates[c * axes + axis];
+                double* lane_drive = drive.data() + (c - c0) * samples;
+                for (size_t s = 0; s < samples; ++s) {
+                    lane_drive[s] = pushed + (undisturbed ? 0.0 : disturbances[s * axes + axis]);
+                }
+            }
+
+            propagateLanes(state.data(), drive.data(), seen_min.data(), seen_max.data(),
+                           lanes, horizon, decay, x0, lo, hi);
+            const double* mn = seen_min.data();
+            const double* mx = seen_max.data();
+
+            for (size_t c = c0; c < c1; ++c) {
+                if (!accepted[c]) {
+                    continue;
+                }
+                const size_t base = (c - c0) * samples;
+                for (size_t s = 0; s < samples; ++s) {
+                    if (mn[base + s] < lo || mx[base + s] > hi) {
+                        accepted[c] = 0;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+    return accepted;
+}
+
+bool BarrierLookahead::checkAction(const CyberswarmKernel& kernel,
+                                   const std::vector<double>& action,
+                                   const std::vector<double>& disturbances) const {
+    if (action.size() != kernel.getConstraints().size()) {
+        return false;
+    }
+    return evaluate(kernel, action, disturbances)[0] != 0;
+}
+
+std::vector<double> boxExtremeDisturbances(const std::vector<double>& radius) {
+    std::vector<double> rows;
+    rows.reserve(radius.size() * 2);
+    for (double r : radius) {
+        rows.push_back(r);
+    }
+    for (double r : radius) {
+        rows.push_back(-r);
+    }
+    return rows;
+}
@@ -4,7 +4,8 @@
 #include <iomanip>
 #include <random>
 
-CybercorePolicy::CybercorePolicy() {
+CybercorePolicy::CybercorePolicy(PolicyStorage storage_mode)
+    : storage(storage_mode) {
     // Default equal weights
     stakeholder_weights = {
         {StakeholderType::CLINICIAN, 1},
@@ -16,6 +17,12 @@ CybercorePolicy::CybercorePolicy() {
     };
 }
 
+CybercorePolicy::~CybercorePolicy() {
+    for (auto& entry : arena_votes) {
+        entry.votes.release(vote_pool);
+    }
+}
+
 std::string CybercorePolicy::proposeDecision(
     const std::string& description, 
     const std::vector<std::string>& neurorights_tags) {
@@ -25,7 +32,10 @@ std::string CybercorePolicy::proposeDecision(
     std::uniform_int_distribution<> dis(100000, 999999);
     
     GovernanceDecision decision;
-    decision.decision_id = "DEC-" + std::to_string(dis(gen));
+    do {
+        // Six random digits collide quickly once thousands of decisions are live
+        decision.decision_id = "DEC-" + std::to_string(dis(gen));
+    } while (decision_index.count(decision.decision_id));
     decision.description = description;
     decision.neurorights_tags = neurorights_tags;
     decision.approved = false;
@@ -36,8 +46,12 @@ std::string CybercorePolicy::proposeDecision(
         return "";  // Invalid tags
     }
     
-    decisions.push_back(decision);
-    return decision.decision_id;
+    decision_index.emplace(decision.decision_id, decisions.size());
+    decisions.push_back(std::move(decision));
+    if (storage == PolicyStorage::ARENA) {
+        arena_votes.emplace_back(text_pool);
+    }
+    return decisions.back().decision_id;
 }
 
 bool CybercorePolicy::castVote(
@@ -47,11 +61,33 @@ bool CybercorePolicy::castVote(
     bool approval,
     const std::string& rationale) {
     
-    auto decision = findDecision(decision_id);
-    if (!decision) {
+    size_t index = findDecisionIndex(decision_id);
+    if (index == npos) {
         return false;
     }
     
+    if (storage == PolicyStorage::ARENA) {
+        auto& entry = arena_votes[index];
+        uint32_t id;
+        if (identifiers.lookup(identifier, id)) {
+            bool already_voted = entry.votes.any([&](const ArenaVote& vote) {
+                return vote.type == type && vote.identifier_id == id;
+            });
+            if (already_voted) {
+                return false;
+            }
+        } else {
+            id = identifiers.intern(identifier);
+        }
+        
+        ArenaVote vote{id, type, approval, std::chrono::system_clock::now(),
+                       entry.rationale_text.store(rationale)};
+        entry.votes.push_back(vote_pool, vote);
+        return true;
+    }
+    
+    auto decision = &decisions[index];
+    
     // Check if stakeholder already voted
     for (const auto& vote : decision->votes) {
         if (vote.type == type && vote.identifier == identifier) {
@@ -77,16 +113,17 @@ bool CybercorePolicy::finalizeDecision(const std::string& decision_id) {
     }
     
     decision->approved = wouldPass(decision_id);
+    decision->finalized = true;
     return decision->approved;
 }
 
 bool CybercorePolicy::wouldPass(const std::string& decision_id) const {
-    const auto* decision = findDecision(decision_id);
-    if (!decision) {
+    size_t index = findDecisionIndex(decision_id);
+    if (index == npos) {
         return false;
     }
     
-    return calculateApprovalRate(*decision) >= decision->consensus_threshold;
+    return calculateApprovalRate(index) >= decisions[index].consensus_threshold;
 }
 
 const GovernanceDecision* CybercorePolicy::getDecision(
@@ -94,6 +131,84 @@ const GovernanceDecision* CybercorePolicy::getDecision(
     return findDecision(decision_id);
 }
 
+std::vector<StakeholderVote> CybercorePolicy::getVotes(
+    const std::string& decision_id) const {
+    
+    size_t index = findDecisionIndex(decision_id);
+    if (index == npos) {
+        return {};
+    }
+    
+    if (storage == PolicyStorage::HEAP) {
+        return decisions[index].votes;
+    }
+    
+    std::vector<StakeholderVote> result;
+    result.reserve(arena_votes[index].votes.size());
+    arena_votes[index].votes.forEach([&](const ArenaVote& vote) {
+        StakeholderVote out;
+        out.type = vote.type;
+        out.identifier = std::string(identifiers.name(vote.identifier_id));
+        out.approval = vote.approval;
+        out.timestamp = vote.timestamp;
+        out.rationale = std::string(vote.rationale);
+        result.push_back(std::move(out));
+    });
+    return result;
+}
+
+size_t CybercorePolicy::archiveFinalizedDecisions() {
+    size_t kept = 0;
+    size_t archived = 0;
+    
+    for (size_t i = 0; i < decisions.size(); ++i) {
+        auto& decision = decisions[i];
+        if (!decision.finalized) {
+            if (kept != i) {
+                decisions[kept] = std::move(decision);
+                if (storage == PolicyStorage::ARENA) {
+                    std::swap(arena_votes[kept], arena_votes[i]);
+                }
+            }
+            ++kept;
+            continue;
+        }
+        
+        decision_index.erase(decision.decision_id);
+        archived_decisions++;
+        if (decision.approved) {
+            archived_approved++;
+        }
+        if (!decision.neurorights_tags.empty()) {
+            archived_tagged++;
+        }
+        for (const auto& tag : decision.neurorights_tags) {
+            archived_tag_counts[tag]++;
+        }
+        
+        if (storage == PolicyStorage::ARENA) {
+            arena_votes[i].votes.release(vote_pool);
+            arena_votes[i].rationale_text.reset();
+        }
+        ++archived;
+    }
+    
+    decisions.resize(kept);
+    for (size_t i = 0; i < decisions.size(); ++i) {
+        decision_index[decisions[i].decision_id] = i;
+    }
+    if (storage == PolicyStorage::ARENA) {
+        arena_votes.erase(arena_votes.begin() + kept, arena_votes.end());
+    }
+    return archived;
+}
+
+size_t CybercorePolicy::releaseUnusedMemory() {
+    size_t bytes = vote_pool.trim() * vote_pool.blockSize() +
+                    text_pool.trim() * text_pool.blockSize();
+    return bytes;
+}
+
 std::vector<GovernanceDecision> CybercorePolicy::getDecisionsByTag(
     const std::string& tag) const {
     
@@ -108,18 +223,19 @@ std::vector<GovernanceDecision> CybercorePolicy::getDecisionsByTag(
 }
 
 double CybercorePolicy::calculatePolicyCoverage() const {
-    if (decisions.empty()) {
+    size_t total_decisions = decisions.size() + archived_decisions;
+    if (total_decisions == 0) {
         return 100.0;  // No decisions means no violations
     }
     
-    int tagged_decisions = 0;
+    int tagged_decisions = archived_tagged;
     for (const auto& decision : decisions) {
         if (!decision.neurorights_tags.empty()) {
             tagged_decisions++;
         }
     }
     
-    return (static_cast<double>(tagged_decisions) / decisions.size()) * 100.0;
+    return (static_cast<double>(tagged_decisions) / total_decisions) * 100.0;
 }
 
 void CybercorePolicy::setStakeholderWeight(StakeholderType type, int weight) {
@@ -132,9 +248,10 @@ void CybercorePolicy::setConsensusThreshold(double threshold) {
 
 CybercorePolicy::ComplianceReport CybercorePolicy::generateComplianceReport() const {
     ComplianceReport report{};
-    report.total_decisions = decisions.size();
+    report.total_decisions = decisions.size() + archived_decisions;
+    report.approved_decisions = archived_approved;
     
-    std::map<std::string, int> tag_counts;
+    std::map<std::string, int> tag_counts = archived_tag_counts;
     
     for (const auto& decision : decisions) {
         if (decision.approved) {
@@ -157,42 +274,43 @@ CybercorePolicy::ComplianceReport CybercorePolicy::generateComplianceReport() co
     return report;
 }
 
+size_t CybercorePolicy::findDecisionIndex(const std::string& decision_id) const {
+    auto it = decision_index.find(decision_id);
+    return it == decision_index.end() ? npos : it->second;
+}
+
 GovernanceDecision* CybercorePolicy::findDecision(const std::string& decision_id) {
-    for (auto& decision : decisions) {
-        if (decision.decision_id == decision_id) {
-            return &decision;
-        }
-    }
-    return nullptr;
+    size_t index = findDecisionIndex(decision_id);
+    return index == npos ? nullptr : &decisions[index];
 }
 
 const GovernanceDecision* CybercorePolicy::findDecision(
     const std::string& decision_id) const {
     
-    for (const auto& decision : decisions) {
-        if (decision.decision_id == decision_id) {
-            return &decision;
-        }
-    }
-    return nullptr;
+    size_t index = findDecisionIndex(decision_id);
+    return index == npos ? nullptr : &decisions[index];
 }
 
-double CybercorePolicy::calculateApprovalRate(
-    const GovernanceDecision& decision) const {
-    
-    if (decision.votes.empty()) {
-        return 0.0;
-    }
-    
+double CybercorePolicy::calculateApprovalRate(size_t index) const {
     double total_weight = 0.0;
     double approval_weight = 0.0;
     
-    for (const auto& vote : decision.votes) {
-        double weight = stakeholder_weights.at(vote.type);
+    auto accumulate = [&](StakeholderType type, bool approval) {
+        double weight = stakeholder_weights.at(type);
         total_weight += weight;
-        if (vote.approval) {
+        if (approval) {
             approval_weight += weight;
         }
+    };
+    
+    if (storage == PolicyStorage::ARENA) {
+        arena_votes[index].votes.forEach([&](const ArenaVote& vote) {
+            accumulate(vote.type, vote.approval);
+        });
+    } else {
+        for (const auto& vote : decisions[index].votes) {
+            accumulate(vote.type, vote.approval);
+        }
     }
     
     return total_weight > 0 ? approval_weight / total_weight : 0.0;
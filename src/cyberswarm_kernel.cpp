@@ -3,6 +3,7 @@
 #include <sstream>
 #include <iomanip>
 #include <cmath>
+#include <chrono>
 
 CyberswarmKernel::CyberswarmKernel() {
     initializeDefaultConstraints();
@@ -39,6 +40,22 @@ void CyberswarmKernel::loadConstraints(const std::vector<NeuroNode>& nodes) {
     }
 }
 
+void CyberswarmKernel::loadBounds(const std::vector<NeuroNode>& nodes) {
+    for (const auto& node : nodes) {
+        SafetyConstraint* constraint = nullptr;
+        if (node.layer == "GovSafety" && node.parameter == "MaxCognitiveLoadIndex") {
+            constraint = findConstraint("cognitive_load");
+        } else if (node.layer == "BCIIngress" && node.parameter == "GatewayPowerDraw") {
+            constraint = findConstraint("power");
+        }
+        if (constraint) {
+            constraint->max_value = node.value;
+            constraint->is_violated = (constraint->current_value < constraint->min_value ||
+                                       constraint->current_value > constraint->max_value);
+        }
+    }
+}
+
 bool CyberswarmKernel::checkViability(const std::vector<double>& proposed_action) const {
     if (proposed_action.size() != AXIS_COUNT) {
         return false;
@@ -87,9 +104,42 @@ std::string CyberswarmKernel::getViolationReport() const {
 void CyberswarmKernel::updateConstraint(const std::string& axis, double value) {
     auto constraint = findConstraint(axis);
     if (constraint) {
-        constraint->current_value = value;
-        constraint->is_violated = (value < constraint->min_value || value > constraint->max_value);
+        updateConstraint(static_cast<size_t>(constraint - constraints.data()), value);
+    }
+}
+
+void CyberswarmKernel::updateConstraint(size_t axis_id, double value) {
+    if (axis_id >= constraints.size()) {
+        return;
+    }
+    auto& constraint = constraints[axis_id];
+    bool was_below = constraint.is_violated && constraint.current_value < constraint.min_value;
+    bool was_violated = constraint.is_violated;
+    
+    constraint.current_value = value;
+    constraint.is_violated = (value < constraint.min_value || value > constraint.max_value);
+    
+    if (!event_sink) {
+        return;
+    }
+    bool is_below = value < constraint.min_value;
+    
+    // Emit on entering or leaving the box, or jumping across it
+    ViolationEvent event{};
+    if (constraint.is_violated && (!was_violated || was_below != is_below)) {
+        event.kind = ViolationEventKind::VIOLATION;
+        event.bound = is_below ? constraint.min_value : constraint.max_value;
+    } else if (!constraint.is_violated && was_violated) {
+        event.kind = ViolationEventKind::RECOVERY;
+        event.bound = was_below ? constraint.min_value : constraint.max_value;
+    } else {
+        return;
     }
+    event.timestamp_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    event.value = value;
+    event.axis_id = static_cast<uint8_t>(axis_id);
+    event_sink->tryPush(event);
 }
 
 double CyberswarmKernel::calculateSafetyMargin() const {
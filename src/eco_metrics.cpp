@@ -1,13 +1,15 @@
 #include "eco_metrics.hpp"
+#include "time_index.hpp"
 
-EcoSummary computeEcoSummary(const std::vector<NeuroNode>& nodes) {
-    EcoSummary s{0.0, 0.0, 0.0, 0.0};
+namespace {
+
+struct EcoAccumulator {
     double sumAll = 0.0; int countAll = 0;
     double sumWater = 0.0; int countWater = 0;
     double sumEnergy = 0.0; int countEnergy = 0;
     double sumBCI = 0.0; int countBCI = 0;
 
-    for (const auto& n : nodes) {
+    void add(const NeuroNode& n) {
         sumAll += n.ecoImpactScore; ++countAll;
 
         if (n.layer == "EcoLink" && 
@@ -24,9 +26,32 @@ EcoSummary computeEcoSummary(const std::vector<NeuroNode>& nodes) {
         }
     }
 
-    s.avgEcoImpactScore   = countAll   ? sumAll   / countAll   : 0.0;
-    s.ecoImpactScoreWater = countWater ? sumWater / countWater : 0.0;
-    s.ecoImpactScoreEnergy= countEnergy? sumEnergy/ countEnergy: 0.0;
-    s.ecoImpactScoreBCI   = countBCI   ? sumBCI   / countBCI   : 0.0;
-    return s;
+    EcoSummary summary() const {
+        EcoSummary s{0.0, 0.0, 0.0, 0.0};
+        s.avgEcoImpactScore   = countAll   ? sumAll   / countAll   : 0.0;
+        s.ecoImpactScoreWater = countWater ? sumWater / countWater : 0.0;
+        s.ecoImpactScoreEnergy= countEnergy? sumEnergy/ countEnergy: 0.0;
+        s.ecoImpactScoreBCI   = countBCI   ? sumBCI   / countBCI   : 0.0;
+        return s;
+    }
+};
+
+}  // namespace
+
+EcoSummary computeEcoSummary(const std::vector<NeuroNode>& nodes) {
+    EcoAccumulator acc;
+    for (const auto& n : nodes) {
+        acc.add(n);
+    }
+    return acc.summary();
+}
+
+EcoSummary computeEcoSummary(const std::vector<NeuroNode>& nodes,
+                             const NodeTimeIndex& windows,
+                             int32_t fromDay, int32_t toDay) {
+    EcoAccumulator acc;
+    for (size_t i : windows.overlapping(fromDay, toDay)) {
+        acc.add(nodes[i]);
+    }
+    return acc.summary();
 }
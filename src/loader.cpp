@@ -1,4 +1,5 @@
 #include "eco_metrics.hpp"
+#include "time_index.hpp"
 #include <fstream>
 #include <sstream>
 #include <stdexcept>
@@ -21,7 +22,7 @@ std::vector<NeuroNode> loadNeurostackEcoShard(const std::string& csvPath) {
         while (std::getline(ss, field, ',')) {
             fields.push_back(field);
         }
-        if (fields.size() < 12) continue;
+        if (fields.size() < 11) continue;
 
         NeuroNode n;
         n.nodeId      = fields[0];
@@ -33,8 +34,13 @@ std::vector<NeuroNode> loadNeurostackEcoShard(const std::string& csvPath) {
         n.unit        = fields[6];
         n.value       = std::stod(fields[7]);
         n.window      = fields[8];
+        parseWindowDays(n.window, n.windowStartDay, n.windowEndDay);
         n.ecoImpactScore = std::stod(fields[9]);
+        // notes are free text and may themselves contain commas
         n.notes       = fields[10];
+        for (size_t i = 11; i < fields.size(); ++i) {
+            n.notes += "," + fields[i];
+        }
         nodes.push_back(n);
     }
     return nodes;
@@ -0,0 +1,236 @@
+#include "shard_snapshot.hpp"
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <filesystem>
+#include <limits>
+#include <stdexcept>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+const auto kPollInterval = std::chrono::milliseconds(200);
+const auto kSettleDelay = std::chrono::milliseconds(50);  // coalesce write bursts
+
+#ifdef __linux__
+// Consume queued inotify events; true if any named the watched file
+bool drainEvents(int fd, const std::string& name) {
+    alignas(inotify_event) char buffer[4096];
+    bool matched = false;
+    ssize_t len;
+    while ((len = read(fd, buffer, sizeof(buffer))) > 0) {
+        for (char* p = buffer; p < buffer + len;) {
+            auto* event = reinterpret_cast<inotify_event*>(p);
+            if (event->len > 0 && name == event->name) {
+                matched = true;
+            }
+            p += sizeof(inotify_event) + event->len;
+        }
+    }
+    return matched;
+}
+#endif
+
+}  // namespace
+
+std::unique_ptr<ShardSnapshot> buildShardSnapshot(const std::string& csvPath,
+                                                  uint64_t version) {
+    auto snapshot = std::make_unique<ShardSnapshot>();
+    snapshot->version = version;
+    snapshot->nodes = loadNeurostackEcoShard(csvPath);
+    snapshot->summary = computeEcoSummary(snapshot->nodes);
+    snapshot->kernel.loadBounds(snapshot->nodes);
+    for (const auto& node : snapshot->nodes) {
+        if (node.layer == "GovOS" && node.parameter == "ConsensusThreshold") {
+            snapshot->consensus_threshold = node.value;
+        }
+    }
+    return snapshot;
+}
+
+SnapshotDomain::~SnapshotDomain() {
+    // No readers may outlive the domain
+    delete current.load();
+    for (auto& entry : retired) {
+        delete entry.second;
+    }
+}
+
+SnapshotDomain::ReaderSlot* SnapshotDomain::claimSlot() {
+    static std::atomic<size_t> next_hint{0};
+    thread_local size_t hint = next_hint.fetch_add(1, std::memory_order_relaxed);
+
+    while (true) {
+        for (size_t i = 0; i < kReaderSlots; ++i) {
+            ReaderSlot& slot = slots[(hint + i) % kReaderSlots];
+            bool expected = false;
+            if (!slot.claimed.load(std::memory_order_relaxed) &&
+                slot.claimed.compare_exchange_strong(expected, true,
+                                                     std::memory_order_acquire)) {
+                hint = (hint + i) % kReaderSlots;
+                return &slot;
+            }
+        }
+        // More than kReaderSlots concurrent readers; wait for one to finish
+        std::this_thread::yield();
+    }
+}
+
+SnapshotDomain::ReadGuard::ReadGuard(SnapshotDomain& domain)
+    : slot(domain.claimSlot()) {
+    // seq_cst orders the epoch store before the pointer load, pairing with
+    // the exchange/fetch_add in publish()
+    slot->epoch.store(domain.global_epoch.load());
+    snapshot = domain.current.load();
+}
+
+SnapshotDomain::ReadGuard::~ReadGuard() {
+    slot->epoch.store(0, std::memory_order_release);
+    slot->claimed.store(false, std::memory_order_release);
+}
+
+void SnapshotDomain::publish(std::unique_ptr<ShardSnapshot> snapshot) {
+    const ShardSnapshot* old = current.exchange(snapshot.release());
+    uint64_t retire_epoch = global_epoch.fetch_add(1);
+    if (old) {
+        std::lock_guard<std::mutex> lock(retire_mutex);
+        retired.emplace_back(retire_epoch, old);
+    }
+    reclaim();
+}
+
+size_t SnapshotDomain::reclaim() {
+    std::lock_guard<std::mutex> lock(retire_mutex);
+    if (retired.empty()) {
+        return 0;
+    }
+
+    uint64_t min_active = std::numeric_limits<uint64_t>::max();
+    for (const auto& slot : slots) {
+        uint64_t epoch = slot.epoch.load();
+        if (epoch != 0) {
+            min_active = std::min(min_active, epoch);
+        }
+    }
+
+    size_t freed = 0;
+    auto keep = std::remove_if(retired.begin(), retired.end(),
+        [&](const std::pair<uint64_t, const ShardSnapshot*>& entry) {
+            if (entry.first < min_active) {
+                delete entry.second;
+                ++freed;
+                return true;
+            }
+            return false;
+        });
+    retired.erase(keep, retired.end());
+    return freed;
+}
+
+size_t SnapshotDomain::pendingReclaim() {
+    std::lock_guard<std::mutex> lock(retire_mutex);
+    return retired.size();
+}
+
+ShardWatcher::ShardWatcher(const std::string& csvPath)
+    : shard_path(csvPath) {
+    domain.publish(buildShardSnapshot(shard_path, next_version++));
+}
+
+ShardWatcher::~ShardWatcher() {
+    stop();
+}
+
+void ShardWatcher::start() {
+    if (running.exchange(true)) {
+        return;
+    }
+#ifdef __linux__
+    // Set up the watch before returning so no later write is missed.
+    // Watch the directory so editors that replace the file via rename are seen.
+    namespace fs = std::filesystem;
+    const fs::path path(shard_path);
+    notify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    std::string dir = path.has_parent_path() ? path.parent_path().string() : ".";
+    if (notify_fd >= 0 &&
+        inotify_add_watch(notify_fd, dir.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE) < 0) {
+        close(notify_fd);
+        notify_fd = -1;
+    }
+#endif
+    worker = std::thread(&ShardWatcher::watchLoop, this);
+}
+
+void ShardWatcher::stop() {
+    running = false;
+    if (worker.joinable()) {
+        worker.join();
+    }
+#ifdef __linux__
+    if (notify_fd >= 0) {
+        close(notify_fd);
+        notify_fd = -1;
+    }
+#endif
+}
+
+std::string ShardWatcher::lastError() {
+    std::lock_guard<std::mutex> lock(error_mutex);
+    return last_error;
+}
+
+void ShardWatcher::reload() {
+    try {
+        auto snapshot = buildShardSnapshot(shard_path, next_version++);
+        if (snapshot->nodes.empty()) {
+            // Likely caught mid-write; keep serving the previous snapshot
+            throw std::runtime_error("No nodes loaded from " + shard_path);
+        }
+        domain.publish(std::move(snapshot));
+    } catch (const std::exception& ex) {
+        failed_reloads++;
+        std::lock_guard<std::mutex> lock(error_mutex);
+        last_error = ex.what();
+    }
+}
+
+void ShardWatcher::watchLoop() {
+    namespace fs = std::filesystem;
+    const fs::path path(shard_path);
+
+#ifdef __linux__
+    if (notify_fd >= 0) {
+        const std::string name = path.filename().string();
+        while (running) {
+            pollfd pfd{notify_fd, POLLIN, 0};
+            if (poll(&pfd, 1, static_cast<int>(kPollInterval.count())) > 0 &&
+                drainEvents(notify_fd, name)) {
+                std::this_thread::sleep_for(kSettleDelay);
+                drainEvents(notify_fd, name);  // same write burst
+                reload();
+            }
+            domain.reclaim();
+        }
+        return;
+    }
+#endif
+
+    // Portable fallback: poll the modification time
+    std::error_code ec;
+    auto last_write = fs::last_write_time(path, ec);
+    while (running) {
+        std::this_thread::sleep_for(kPollInterval);
+        auto write_time = fs::last_write_time(path, ec);
+        if (!ec && write_time != last_write) {
+            last_write = write_time;
+            std::this_thread::sleep_for(kSettleDelay);
+            reload();
+        }
+        domain.reclaim();
+    }
+}
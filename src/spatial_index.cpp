@@ -0,0 +1,291 @@
+#include "spatial_index.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+
+const double kPi = 3.14159265358979323846;
+const double kEarthRadiusKm = 6371.0088;
+const double kKmPerDegree = kEarthRadiusKm * kPi / 180.0;
+const size_t kMaxCells = size_t(1) << 24;
+const double kBoundSlackKm = 1e-6;  // absorbs rounding at cell edges
+
+double toRadians(double degrees) {
+    return degrees * kPi / 180.0;
+}
+
+// Grid coordinate of value, clamped to [-1, count] so far-off query
+// points cannot overflow the int conversion
+int cellCoordinate(double value, double origin, double cell_degrees, int count) {
+    double c = std::floor((value - origin) / cell_degrees);
+    return static_cast<int>(std::max(-1.0, std::min(c, static_cast<double>(count))));
+}
+
+// Great-circle distance from a point to the meridian dlon_degrees away,
+// a lower bound for any point at least that far away in longitude. Past
+// 90 degrees the closest point on the meridian is the pole.
+double meridianDistanceKm(double latitude, double dlon_degrees) {
+    if (dlon_degrees <= 0.0) {
+        return 0.0;
+    }
+    double s = std::cos(toRadians(latitude)) * std::sin(toRadians(std::min(dlon_degrees, 90.0)));
+    return kEarthRadiusKm * std::asin(std::min(1.0, std::fabs(s)));
+}
+
+}  // namespace
+
+double haversineKm(double lat1, double lon1, double lat2, double lon2) {
+    double dlat = toRadians(lat2 - lat1);
+    double dlon = toRadians(lon2 - lon1);
+    double a = std::sin(dlat / 2) * std::sin(dlat / 2) +
+               std::cos(toRadians(lat1)) * std::cos(toRadians(lat2)) *
+               std::sin(dlon / 2) * std::sin(dlon / 2);
+    return 2.0 * kEarthRadiusKm * std::asin(std::min(1.0, std::sqrt(a)));
+}
+
+NodeSpatialIndex::NodeSpatialIndex(
+    const std::vector<NeuroNode>& nodes,
+    double cell_size_degrees,
+    const std::function<bool(const NeuroNode&)>& include) {
+
+    std::vector<size_t> selected;
+    selected.reserve(nodes.size());
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        if (!include || include(nodes[i])) {
+            selected.push_back(i);
+        }
+    }
+    if (selected.empty()) {
+        return;
+    }
+
+    double min_lat = 90.0, max_lat = -90.0;
+    double min_lon = 180.0, max_lon = -180.0;
+    for (size_t i : selected) {
+        min_lat = std::min(min_lat, nodes[i].latitude);
+        max_lat = std::max(max_lat, nodes[i].latitude);
+        min_lon = std::min(min_lon, nodes[i].longitude);
+        max_lon = std::max(max_lon, nodes[i].longitude);
+    }
+    double lat_span = max_lat - min_lat;
+    double lon_span = max_lon - min_lon;
+
+    cell_degrees = cell_size_degrees;
+    if (cell_degrees <= 0.0) {
+        // Aim for roughly two nodes per occupied cell
+        double area = std::max(lat_span, 1e-6) * std::max(lon_span, 1e-6);
+        cell_degrees = std::sqrt(area / std::max<size_t>(1, selected.size() / 2));
+    }
+    cell_degrees = std::max(cell_degrees, 1e-5);
+
+    // Coarsen until the grid fits the cell budget
+    while (true) {
+        columns = static_cast<int>(lon_span / cell_degrees) + 1;
+        rows = static_cast<int>(lat_span / cell_degrees) + 1;
+        if (static_cast<size_t>(columns) * rows <= kMaxCells) {
+            break;
+        }
+        cell_degrees *= 2.0;
+    }
+    origin_latitude = min_lat;
+    origin_longitude = min_lon;
+
+    // Counting sort of nodes into cells
+    size_t cell_count = static_cast<size_t>(columns) * rows;
+    std::vector<uint32_t> cell_of(selected.size());
+    cell_start.assign(cell_count + 1, 0);
+    for (size_t k = 0; k < selected.size(); ++k) {
+        const auto& n = nodes[selected[k]];
+        int col = std::min(columns - 1, static_cast<int>((n.longitude - origin_longitude) / cell_degrees));
+        int row = std::min(rows - 1, static_cast<int>((n.latitude - origin_latitude) / cell_degrees));
+        cell_of[k] = static_cast<uint32_t>(row) * columns + col;
+        cell_start[cell_of[k] + 1]++;
+    }
+    for (size_t c = 0; c < cell_count; ++c) {
+        cell_start[c + 1] += cell_start[c];
+    }
+
+    entry_latitude.resize(selected.size());
+    entry_longitude.resize(selected.size());
+    entry_node.resize(selected.size());
+    std::vector<uint32_t> cursor(cell_start.begin(), cell_start.end() - 1);
+    for (size_t k = 0; k < selected.size(); ++k) {
+        uint32_t slot = cursor[cell_of[k]]++;
+        const auto& n = nodes[selected[k]];
+        entry_latitude[slot] = n.latitude;
+        entry_longitude[slot] = n.longitude;
+        entry_node[slot] = selected[k];
+    }
+}
+
+std::vector<size_t> NodeSpatialIndex::queryRadius(
+    double latitude, double longitude, double radius_km) const {
+
+    std::vector<size_t> result;
+    if (entry_node.empty() || radius_km < 0.0) {
+        return result;
+    }
+
+    double dlat = radius_km / kKmPerDegree;
+    double max_abs_lat = std::min(90.0, std::max(std::fabs(latitude - dlat),
+                                                 std::fabs(latitude + dlat)));
+    double cos_lat = std::cos(toRadians(max_abs_lat));
+    double dlon = cos_lat > 1e-9 ? radius_km / (kKmPerDegree * cos_lat) : 360.0;
+
+    // A box reaching past +/-180 also covers the wrapped copy on the other
+    // side; under 180 degrees wide the copies never overlap
+    double shifts[3] = {0.0, 360.0, -360.0};
+    int shift_count = 3;
+    if (dlon >= 180.0) {
+        dlon = 360.0;
+        shift_count = 1;
+    }
+    for (int s = 0; s < shift_count; ++s) {
+        double lon0 = longitude - dlon + shifts[s];
+        double lon1 = longitude + dlon + shifts[s];
+        int col0 = cellCoordinate(lon0, origin_longitude, cell_degrees, columns);
+        int col1 = cellCoordinate(lon1, origin_longitude, cell_degrees, columns);
+        int row0 = cellCoordinate(latitude - dlat, origin_latitude, cell_degrees, rows);
+        int row1 = cellCoordinate(latitude + dlat, origin_latitude, cell_degrees, rows);
+        col0 = std::max(col0, 0); col1 = std::min(col1, columns - 1);
+        row0 = std::max(row0, 0); row1 = std::min(row1, rows - 1);
+        if (col0 > col1 || row0 > row1) {
+            continue;
+        }
+
+        for (int row = row0; row <= row1; ++row) {
+            uint32_t begin = cell_start[static_cast<size_t>(row) * columns + col0];
+            uint32_t end = cell_start[static_cast<size_t>(row) * columns + col1 + 1];
+            for (uint32_t e = begin; e < end; ++e) {
+                if (haversineKm(latitude, longitude, entry_latitude[e], entry_longitude[e]) <= radius_km) {
+                    result.push_back(entry_node[e]);
+                }
+            }
+        }
+    }
+    return result;
+}
+
+std::vector<size_t> NodeSpatialIndex::queryBoundingBox(const GeoBounds& bounds) const {
+    std::vector<size_t> result;
+    if (entry_node.empty()) {
+        return result;
+    }
+
+    int col0 = cellCoordinate(bounds.min_longitude, origin_longitude, cell_degrees, columns);
+    int col1 = cellCoordinate(bounds.max_longitude, origin_longitude, cell_degrees, columns);
+    int row0 = cellCoordinate(bounds.min_latitude, origin_latitude, cell_degrees, rows);
+    int row1 = cellCoordinate(bounds.max_latitude, origin_latitude, cell_degrees, rows);
+    col0 = std::max(col0, 0); col1 = std::min(col1, columns - 1);
+    row0 = std::max(row0, 0); row1 = std::min(row1, rows - 1);
+    if (col0 > col1 || row0 > row1) {
+        return result;
+    }
+
+    for (int row = row0; row <= row1; ++row) {
+        // Cells in a row are contiguous, so one span covers col0..col1
+        uint32_t begin = cell_start[static_cast<size_t>(row) * columns + col0];
+        uint32_t end = cell_start[static_cast<size_t>(row) * columns + col1 + 1];
+        for (uint32_t e = begin; e < end; ++e) {
+            if (entry_latitude[e] >= bounds.min_latitude &&
+                entry_latitude[e] <= bounds.max_latitude &&
+                entry_longitude[e] >= bounds.min_longitude &&
+                entry_longitude[e] <= bounds.max_longitude) {
+                result.push_back(entry_node[e]);
+            }
+        }
+    }
+    return result;
+}
+
+bool NodeSpatialIndex::nearest(double latitude, double longitude,
+                               size_t& node_index, double& distance_km) const {
+    if (entry_node.empty()) {
+        return false;
+    }
+
+    int qcol = cellCoordinate(longitude, origin_longitude, cell_degrees, columns);
+    int qrow = cellCoordinate(latitude, origin_latitude, cell_degrees, rows);
+    qcol = std::max(0, std::min(qcol, columns - 1));
+    qrow = std::max(0, std::min(qrow, rows - 1));
+
+    double best = std::numeric_limits<double>::infinity();
+    size_t best_node = 0;
+
+    auto scanCell = [&](int col, int row) {
+        size_t cell = static_cast<size_t>(row) * columns + col;
+        for (uint32_t e = cell_start[cell]; e < cell_start[cell + 1]; ++e) {
+            double d = haversineKm(latitude, longitude, entry_latitude[e], entry_longitude[e]);
+            if (d < best) {
+                best = d;
+                best_node = entry_node[e];
+            }
+        }
+    };
+
+    for (int r = 0; ; ++r) {
+        int col0 = qcol - r, col1 = qcol + r;
+        int row0 = qrow - r, row1 = qrow + r;
+        for (int row = std::max(row0, 0); row <= std::min(row1, rows - 1); ++row) {
+            if (row == row0 || row == row1) {
+                for (int col = std::max(col0, 0); col <= std::min(col1, columns - 1); ++col) {
+                    scanCell(col, row);
+                }
+            } else {
+                if (col0 >= 0) scanCell(col0, row);
+                if (col1 < columns && col1 != col0) scanCell(col1, row);
+            }
+        }
+
+        // Every unscanned cell lies beyond one edge of the scanned box, so
+        // the nearest such edge bounds their great-circle distance
+        double bound = std::numeric_limits<double>::infinity();
+        if (row1 + 1 < rows) {
+            double edge = origin_latitude + (row1 + 1) * cell_degrees;
+            bound = std::min(bound, std::max(0.0, edge - latitude) * kKmPerDegree);
+        }
+        if (row0 > 0) {
+            double edge = origin_latitude + row0 * cell_degrees;
+            bound = std::min(bound, std::max(0.0, latitude - edge) * kKmPerDegree);
+        }
+        // Past the antimeridian the far end of the grid can be the closer
+        // way round, so a column range is only as far as its nearer end
+        const double grid_east = origin_longitude + columns * cell_degrees;
+        if (col1 + 1 < columns) {
+            double edge = origin_longitude + (col1 + 1) * cell_degrees;
+            bound = std::min(bound, meridianDistanceKm(
+                latitude, std::min(edge - longitude, 360.0 - (grid_east - longitude))));
+        }
+        if (col0 > 0) {
+            double edge = origin_longitude + col0 * cell_degrees;
+            bound = std::min(bound, meridianDistanceKm(
+                latitude, std::min(longitude - edge, 360.0 - (longitude - origin_longitude))));
+        }
+        if (bound == std::numeric_limits<double>::infinity() || best <= bound - kBoundSlackKm) {
+            break;
+        }
+    }
+
+    node_index = best_node;
+    distance_km = best;
+    return true;
+}
+
+std::vector<NearestNodeMatch> nearestEcoLinkForIngress(const std::vector<NeuroNode>& nodes) {
+    NodeSpatialIndex eco_index(nodes, 0.0, [](const NeuroNode& n) {
+        return n.layer == "EcoLink";
+    });
+
+    std::vector<NearestNodeMatch> matches;
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        if (nodes[i].layer != "BCIIngress") {
+            continue;
+        }
+        NearestNodeMatch match{i, SIZE_MAX, 0.0};
+        eco_index.nearest(nodes[i].latitude, nodes[i].longitude,
+                          match.nearest_index, match.distance_km);
+        matches.push_back(match);
+    }
+    return matches;
+}
@@ -0,0 +1,169 @@
+#include "time_index.hpp"
+#include <algorithm>
+
+namespace {
+
+// Days since 1970-01-01 for a proleptic Gregorian date
+int32_t daysFromCivil(int y, unsigned m, unsigned d) {
+    y -= m <= 2;
+    const int era = (y >= 0 ? y : y - 399) / 400;
+    const unsigned yoe = static_cast<unsigned>(y - era * 400);
+    const unsigned doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + static_cast<int32_t>(doe) - 719468;
+}
+
+unsigned daysInMonth(int y, unsigned m) {
+    static const unsigned kDays[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    bool leap = (y % 4 == 0 && y % 100 != 0) || y % 400 == 0;
+    return m == 2 && leap ? 29 : kDays[m - 1];
+}
+
+bool parseDigits(const std::string& text, size_t pos, size_t count, int& out) {
+    out = 0;
+    for (size_t i = pos; i < pos + count; ++i) {
+        if (text[i] < '0' || text[i] > '9') {
+            return false;
+        }
+        out = out * 10 + (text[i] - '0');
+    }
+    return true;
+}
+
+}  // namespace
+
+bool parseIsoDay(const std::string& text, int32_t& day) {
+    if (text.size() != 10 || text[4] != '-' || text[7] != '-') {
+        return false;
+    }
+    int year, month, dom;
+    if (!parseDigits(text, 0, 4, year) ||
+        !parseDigits(text, 5, 2, month) ||
+        !parseDigits(text, 8, 2, dom)) {
+        return false;
+    }
+    if (month < 1 || month > 12 || dom < 1 ||
+        dom > static_cast<int>(daysInMonth(year, month))) {
+        return false;
+    }
+    day = daysFromCivil(year, month, dom);
+    return true;
+}
+
+bool parseWindowDays(const std::string& window, int32_t& start_day, int32_t& end_day) {
+    size_t slash = window.find('/');
+    if (slash == std::string::npos) {
+        return false;
+    }
+    int32_t start, end;
+    if (!parseIsoDay(window.substr(0, slash), start) ||
+        !parseIsoDay(window.substr(slash + 1), end) ||
+        start > end) {
+        return false;
+    }
+    start_day = start;
+    end_day = end;
+    return true;
+}
+
+NodeTimeIndex::NodeTimeIndex(const std::vector<NeuroNode>& nodes) {
+    std::vector<size_t> order;
+    order.reserve(nodes.size());
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        if (nodes[i].windowStartDay <= nodes[i].windowEndDay) {
+            order.push_back(i);
+        }
+    }
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return nodes[a].windowStartDay < nodes[b].windowStartDay;
+    });
+
+    const int64_t n = static_cast<int64_t>(order.size());
+    starts.resize(n);
+    ends.resize(n);
+    max_ends.resize(n);
+    node_of = order;
+    for (int64_t i = 0; i < n; ++i) {
+        starts[i] = nodes[order[i]].windowStartDay;
+        ends[i] = nodes[order[i]].windowEndDay + 1;
+    }
+    if (n == 0) {
+        return;
+    }
+
+    // Leaves sit at even slots; a slot with k trailing one bits is an
+    // inner node at level k covering 2^(k+1)-1 slots around it.
+    int64_t last_i = 0;
+    int32_t last = 0;
+    for (int64_t i = 0; i < n; i += 2) {
+        last_i = i;
+        last = max_ends[i] = ends[i];
+    }
+    int k = 1;
+    for (; (int64_t(1) << k) <= n; ++k) {
+        int64_t x = int64_t(1) << (k - 1);
+        int64_t i0 = (x << 1) - 1;
+        int64_t step = x << 2;
+        for (int64_t i = i0; i < n; i += step) {
+            int32_t left = max_ends[i - x];
+            int32_t right = i + x < n ? max_ends[i + x] : last;
+            max_ends[i] = std::max({ends[i], left, right});
+        }
+        last_i = (last_i >> k & 1) ? last_i - x : last_i + x;
+        if (last_i < n && max_ends[last_i] > last) {
+            last = max_ends[last_i];
+        }
+    }
+    max_level = k - 1;
+}
+
+std::vector<size_t> NodeTimeIndex::activeOn(int32_t day) const {
+    return overlapping(day, day);
+}
+
+std::vector<size_t> NodeTimeIndex::overlapping(int32_t from_day, int32_t to_day) const {
+    std::vector<size_t> result;
+    if (max_level < 0 || from_day > to_day) {
+        return result;
+    }
+
+    // Half-open query [st, en) against half-open intervals
+    const int32_t st = from_day;
+    const int32_t en = to_day + 1;
+    const int64_t n = static_cast<int64_t>(starts.size());
+
+    struct Frame {
+        int64_t x;
+        int k;
+        bool left_done;
+    };
+    Frame stack[64];
+    int top = 0;
+    stack[top++] = {(int64_t(1) << max_level) - 1, max_level, false};
+
+    while (top) {
+        Frame z = stack[--top];
+        if (z.k <= 3) {
+            // Small subtree: scan its slots directly
+            int64_t i0 = z.x >> z.k << z.k;
+            int64_t i1 = std::min(n, i0 + (int64_t(1) << (z.k + 1)) - 1);
+            for (int64_t i = i0; i < i1 && starts[i] < en; ++i) {
+                if (st < ends[i]) {
+                    result.push_back(node_of[i]);
+                }
+            }
+        } else if (!z.left_done) {
+            int64_t y = z.x - (int64_t(1) << (z.k - 1));
+            stack[top++] = {z.x, z.k, true};
+            if (y >= n || max_ends[y] > st) {
+                stack[top++] = {y, z.k - 1, false};
+            }
+        } else if (z.x < n && starts[z.x] < en) {
+            if (st < ends[z.x]) {
+                result.push_back(node_of[z.x]);
+            }
+            stack[top++] = {z.x + (int64_t(1) << (z.k - 1)), z.k - 1, false};
+        }
+    }
+    return result;
+}
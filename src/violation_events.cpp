@@ -0,0 +1,63 @@
+#include "violation_events.hpp"
+#include <iomanip>
+#include <sstream>
+
+ViolationEventRing::ViolationEventRing(size_t capacity) {
+    size_t size = 2;
+    while (size < capacity) {
+        size <<= 1;
+    }
+    buffer.resize(size);
+    mask = size - 1;
+}
+
+bool ViolationEventRing::tryPush(const ViolationEvent& event) {
+    size_t h = head.load(std::memory_order_relaxed);
+    if (h - cached_tail == buffer.size()) {
+        cached_tail = tail.load(std::memory_order_acquire);
+        if (h - cached_tail == buffer.size()) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+    }
+    buffer[h & mask] = event;
+    head.store(h + 1, std::memory_order_release);
+    return true;
+}
+
+size_t ViolationEventRing::drain(ViolationEvent* out, size_t max_events) {
+    size_t t = tail.load(std::memory_order_relaxed);
+    if (cached_head - t < max_events) {
+        // Not enough known events for a full batch; look for newer ones
+        cached_head = head.load(std::memory_order_acquire);
+    }
+    size_t count = 0;
+    while (t != cached_head && count < max_events) {
+        out[count++] = buffer[t & mask];
+        ++t;
+    }
+    tail.store(t, std::memory_order_release);
+    return count;
+}
+
+size_t drainViolationEventsToFile(ViolationEventRing& ring, std::FILE* out) {
+    ViolationEvent batch[256];
+    size_t total = 0;
+    size_t count;
+    while ((count = ring.drain(batch, sizeof(batch) / sizeof(batch[0]))) > 0) {
+        total += std::fwrite(batch, sizeof(ViolationEvent), count, out);
+    }
+    return total;
+}
+
+std::string formatViolationEvent(const ViolationEvent& event, const std::string& axis) {
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(3);
+    ss << "[" << event.timestamp_ns << "] " << axis << ": ";
+    if (event.kind == ViolationEventKind::VIOLATION) {
+        ss << "value " << event.value << " crossed bound " << event.bound;
+    } else {
+        ss << "recovered to " << event.value << " (bound " << event.bound << ")";
+    }
+    return ss.str();
+}
@@ -0,0 +1,160 @@
+#include "aln_registry.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <unistd.h>
+#include "test_support.hpp"
+
+namespace {
+
+bool listsToken(std::string_view value, std::string_view token) {
+    size_t start = 0;
+    while (true) {
+        size_t plus = value.find('+', start);
+        if (value.substr(start, plus == std::string_view::npos ? plus : plus - start) == token) {
+            return true;
+        }
+        if (plus == std::string_view::npos) {
+            return false;
+        }
+        start = plus + 1;
+    }
+}
+
+std::vector<size_t> bruteRows(const AlnRegistry& registry, const std::string& column,
+                              const std::string& needle, bool contains) {
+    std::vector<size_t> rows;
+    int c = registry.columnIndex(column);
+    if (c < 0) {
+        return rows;
+    }
+    for (size_t r = 0; r < registry.rowCount(); ++r) {
+        auto v = registry.value(r, c);
+        if (contains ? listsToken(v, needle) : v == needle) {
+            rows.push_back(r);
+        }
+    }
+    return rows;
+}
+
+void checkColumn(const AlnRegistry& registry, const std::string& column,
+                 const std::vector<std::string>& probes) {
+    for (const auto& probe : probes) {
+        auto equals = registry.whereEquals(column, probe);
+        CHECK(equals.rows() == bruteRows(registry, column, probe, false));
+        CHECK(equals.count() == equals.rows().size());
+        auto contains = registry.whereContains(column, probe);
+        CHECK(contains.rows() == bruteRows(registry, column, probe, true));
+    }
+}
+
+void checkShippedShard() {
+    auto registry = loadAlnRegistry(std::string(PHOENIX_SOURCE_DIR) +
+                                    "/qpudatashards/ethics/NeuroContentSafety_2026v1.aln");
+    CHECK(registry.fileName() == "qpudatashards/ethics/NeuroContentSafety_2026v1.aln");
+    CHECK(registry.destinationFolder() == "qpudatashards/ethics");
+    CHECK(registry.rowCount() > 0);
+    CHECK(registry.columnIndex("compliance") >= 0);
+    CHECK(registry.columnIndex("device-type") >= 0);
+    CHECK(registry.columnIndex("no-such-column") == -1);
+
+    auto hipaa_edge = registry.whereContains("compliance", "HIPAA") &
+                      registry.whereEquals("device-type", "BCIEdge");
+    std::vector<size_t> expected;
+    auto hipaa = bruteRows(registry, "compliance", "HIPAA", true);
+    auto edge = bruteRows(registry, "device-type", "BCIEdge", false);
+    for (size_t r : hipaa) {
+        if (std::find(edge.begin(), edge.end(), r) != edge.end()) {
+            expected.push_back(r);
+        }
+    }
+    CHECK(hipaa_edge.rows() == expected);
+
+    for (size_t c = 0; c < registry.columnCount(); ++c) {
+        std::vector<std::string> probes = {"", "missing"};
+        for (auto v : registry.distinctValues(registry.columnName(c))) {
+            probes.emplace_back(v);
+        }
+        probes.push_back("GDPR");
+        probes.push_back("EUAI");
+        checkColumn(registry, registry.columnName(c), probes);
+    }
+}
+
+void checkSynthetic() {
+    const std::string path = "/tmp/phoenix_aln_test_" + std::to_string(getpid()) + ".aln";
+    const std::vector<std::string> devices = {"BCIEdge", "ClusterNode", "XRHeadset", "Gateway"};
+    const std::vector<std::string> regimes = {"GDPR", "EUAI", "HIPAA", "FCC15", "MedDevice", ""};
+    std::mt19937 gen(17);
+    {
+        std::ofstream out(path);
+        out << "filename," << path << "\n"
+            << "destination-folder,/tmp\n"
+            << "destination-path,device-type,compliance,role\n";
+        for (int row = 0; row < 6000; ++row) {
+            std::string compliance;
+            int items = 1 + gen() % 4;
+            for (int i = 0; i < items; ++i) {
+                compliance += (i ? "+" : "") + regimes[gen() % regimes.size()];
+            }
+            out << "vnode/" << row << ".aln," << devices[gen() % devices.size()] << ","
+                << compliance << ",Role" << gen() % 300 << (row % 7 == 0 ? "\r\n" : "\n");
+            if (row % 1000 == 0) {
+                out << "malformed,row\n";
+            }
+        }
+    }
+
+    auto registry = loadAlnRegistry(path);
+    std::remove(path.c_str());
+    CHECK(registry.rowCount() == 6000);
+    CHECK(registry.columnCount() == 4);
+
+    std::vector<std::string> probes = {"", "missing", "GDPR+EUAI", "vnode/17.aln", "Role5"};
+    probes.insert(probes.end(), devices.begin(), devices.end());
+    probes.insert(probes.end(), regimes.begin(), regimes.end());
+    for (const char* column : {"destination-path", "device-type", "compliance", "role"}) {
+        checkColumn(registry, column, probes);
+    }
+
+    // Combined predicates against a row-by-row evaluation
+    auto result = registry.whereContains("compliance", "HIPAA") &
+                  registry.whereEquals("device-type", "BCIEdge");
+    result.andNot(registry.whereContains("compliance", "GDPR"));
+    result |= registry.whereEquals("role", "Role7");
+    std::vector<size_t> expected;
+    for (size_t r = 0; r < registry.rowCount(); ++r) {
+        auto compliance = registry.value(r, 2);
+        bool match = (listsToken(compliance, "HIPAA") && registry.value(r, 1) == "BCIEdge" &&
+                      !listsToken(compliance, "GDPR")) ||
+                     registry.value(r, 3) == "Role7";
+        if (match) {
+            expected.push_back(r);
+        }
+    }
+    CHECK(result.rows() == expected);
+
+    CHECK(registry.whereEquals("no-such-column", "x").count() == 0);
+    CHECK(registry.whereContains("no-such-column", "x").count() == 0);
+    CHECK(registry.distinctValues("device-type").size() == devices.size());
+}
+
+}  // namespace
+
+int main() {
+    checkShippedShard();
+    checkSynthetic();
+
+    bool threw = false;
+    try {
+        loadAlnRegistry("/nonexistent/registry.aln");
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    CHECK(threw);
+    return 0;
+}
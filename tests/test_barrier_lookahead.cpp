@@ -0,0 +1,122 @@
+#include "barrier_lookahead.hpp"
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include "test_support.hpp"
+
+namespace {
+
+// Straight per-trajectory simulation of the same rule
+bool referenceAccepts(const CyberswarmKernel& kernel, const std::vector<AxisDynamics>& model,
+                      int horizon, const double* action,
+                      const std::vector<double>& disturbances) {
+    const auto& constraints = kernel.getConstraints();
+    const size_t axes = constraints.size();
+    const size_t samples = disturbances.empty() ? 1 : disturbances.size() / axes;
+    for (size_t s = 0; s < samples; ++s) {
+        for (size_t a = 0; a < axes; ++a) {
+            double d = disturbances.empty() ? 0.0 : disturbances[s * axes + a];
+            double drive = model[a].gain * action[a] + d;
+            double x = constraints[a].current_value;
+            for (int t = 0; t < horizon; ++t) {
+                x = model[a].decay * x + drive;
+                if (x < constraints[a].min_value || x > constraints[a].max_value) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+int main() {
+    std::mt19937 gen(5);
+    CyberswarmKernel kernel;
+    const auto& constraints = kernel.getConstraints();
+    const size_t axes = constraints.size();
+
+    // Start every axis somewhere inside its box
+    for (size_t a = 0; a < axes; ++a) {
+        std::uniform_real_distribution<> inside(constraints[a].min_value, constraints[a].max_value);
+        kernel.updateConstraint(a, inside(gen));
+    }
+
+    std::vector<AxisDynamics> model(axes);
+    BarrierLookahead lookahead(axes, 8);
+    std::uniform_real_distribution<> decay(0.0, 1.0), gain(0.01, 0.3);
+    for (size_t a = 0; a < axes; ++a) {
+        model[a] = {decay(gen), gain(gen)};
+        lookahead.setAxisDynamics(a, model[a]);
+    }
+
+    size_t accepted_total = 0, rejected_total = 0;
+
+    // Candidate counts straddle the lane block so partial blocks are covered
+    for (size_t sample_count : {0, 1, 2, 7, 300, 5000}) {
+        std::vector<double> disturbances(sample_count * axes);
+        for (size_t s = 0; s < sample_count; ++s) {
+            for (size_t a = 0; a < axes; ++a) {
+                double span = constraints[a].max_value - constraints[a].min_value;
+                disturbances[s * axes + a] = std::uniform_real_distribution<>(-0.05, 0.05)(gen) * span;
+            }
+        }
+        for (size_t candidate_count : {1, 3, 1000, 2049}) {
+            std::vector<double> candidates(candidate_count * axes);
+            for (size_t c = 0; c < candidate_count; ++c) {
+                for (size_t a = 0; a < axes; ++a) {
+                    double span = constraints[a].max_value - constraints[a].min_value;
+                    candidates[c * axes + a] = std::uniform_real_distribution<>(-0.5, 0.5)(gen) * span;
+                }
+            }
+            auto accepted = lookahead.evaluate(kernel, candidates, disturbances);
+            CHECK(accepted.size() == candidate_count);
+            for (size_t c = 0; c < candidate_count; ++c) {
+                (accepted[c] ? accepted_total : rejected_total)++;
+                CHECK((accepted[c] != 0) ==
+                      referenceAccepts(kernel, model, lookahead.getHorizon(),
+                                       &candidates[c * axes], disturbances));
+            }
+        }
+    }
+
+    CHECK(accepted_total > 0 && rejected_total > 0);
+
+    // Box extremes bound every constant disturbance inside the box
+    std::vector<double> radius(axes);
+    for (size_t a = 0; a < axes; ++a) {
+        radius[a] = 0.02 * (constraints[a].max_value - constraints[a].min_value);
+    }
+    auto extremes = boxExtremeDisturbances(radius);
+    CHECK(extremes.size() == 2 * axes);
+    std::vector<double> interior(200 * axes);
+    for (size_t i = 0; i < interior.size(); ++i) {
+        interior[i] = std::uniform_real_distribution<>(-1.0, 1.0)(gen) * radius[i % axes];
+    }
+    std::vector<double> candidates(500 * axes);
+    for (size_t i = 0; i < candidates.size(); ++i) {
+        double span = constraints[i % axes].max_value - constraints[i % axes].min_value;
+        candidates[i] = std::uniform_real_distribution<>(-0.3, 0.3)(gen) * span;
+    }
+    auto worst = lookahead.evaluate(kernel, candidates, extremes);
+    auto sampled = lookahead.evaluate(kernel, candidates, interior);
+    for (size_t c = 0; c < worst.size(); ++c) {
+        CHECK(!worst[c] || sampled[c]);
+    }
+
+    // Single-action entry point and malformed rows
+    std::vector<double> idle(axes, 0.0);
+    lookahead.setHorizon(3);
+    CHECK(lookahead.checkAction(kernel, idle, {}) ==
+          referenceAccepts(kernel, model, 3, idle.data(), {}));
+    CHECK(!lookahead.checkAction(kernel, std::vector<double>(axes - 1, 0.0), {}));
+    bool threw = false;
+    try {
+        lookahead.evaluate(kernel, std::vector<double>(axes + 1, 0.0), {});
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    CHECK(threw);
+    return 0;
+}
@@ -0,0 +1,62 @@
+#include "cybercore_policy.hpp"
+#include <set>
+#include <string>
+#include <vector>
+#include "test_support.hpp"
+
+static void testVotingAndArchive(PolicyStorage mode) {
+    CybercorePolicy policy(mode);
+    std::vector<std::string> ids;
+
+    for (int d = 0; d < 50; ++d) {
+        ids.push_back(policy.proposeDecision("decision", {"neurorights.privacy"}));
+        CHECK(!ids.back().empty());
+        for (int v = 0; v < 500; ++v) {
+            CHECK(policy.castVote(ids.back(), StakeholderType::CLINICIAN,
+                                  "did:phx:" + std::to_string(v), v % 4 != 0,
+                                  std::string(v % 7 * 100, 'r')));
+        }
+        // Duplicate votes are rejected
+        CHECK(!policy.castVote(ids.back(), StakeholderType::CLINICIAN, "did:phx:3", true));
+    }
+
+    auto votes = policy.getVotes(ids[5]);
+    CHECK(votes.size() == 500);
+    CHECK(votes[13].identifier == "did:phx:13");
+    CHECK(votes[13].rationale.size() == 600);
+    CHECK(policy.wouldPass(ids[0]));
+
+    for (int d = 0; d < 50; d += 2) {
+        policy.finalizeDecision(ids[d]);
+    }
+    CHECK(policy.archiveFinalizedDecisions() == 25);
+    CHECK(policy.getDecision(ids[0]) == nullptr);
+    CHECK(policy.getDecision(ids[7]) != nullptr);
+    CHECK(policy.getVotes(ids[7]).size() == 500);
+    CHECK(policy.getVotes(ids[7])[499].identifier == "did:phx:499");
+
+    auto report = policy.generateComplianceReport();
+    CHECK(report.total_decisions == 50);
+    CHECK(report.approved_decisions == 25);
+    CHECK(report.tag_distribution["neurorights.privacy"] == 50);
+
+    if (mode == PolicyStorage::ARENA) {
+        CHECK(policy.releaseUnusedMemory() > 0);
+        CHECK(policy.getVotes(ids[9]).size() == 500);
+    }
+}
+
+static void testDecisionIdsUnique() {
+    CybercorePolicy policy;
+    std::set<std::string> seen;
+    for (int d = 0; d < 20000; ++d) {
+        CHECK(seen.insert(policy.proposeDecision("d")).second);
+    }
+}
+
+int main() {
+    testVotingAndArchive(PolicyStorage::HEAP);
+    testVotingAndArchive(PolicyStorage::ARENA);
+    testDecisionIdsUnique();
+    return 0;
+}
@@ -0,0 +1,140 @@
+#include "shard_snapshot.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+#include "test_support.hpp"
+
+namespace {
+
+namespace fs = std::filesystem;
+
+// Write to a temp file and rename over the shard, as an editor would
+void writeShard(const fs::path& path, double max_load, double power, double threshold) {
+    fs::path tmp = path;
+    tmp += ".tmp";
+    {
+        std::ofstream out(tmp);
+        out << "nodeid,layer,region,latitude,longitude,parameter,unit,value,window,ecoimpactscore,notes\n"
+            << "PHX-N1-INGRESS,BCIIngress,Phoenix-AZ,33.45,-112.07,GatewayPowerDraw,mW,"
+            << power << ",2026-01-01/2026-12-31,0.82,ingress\n"
+            << "PHX-CYBERSWARM,GovSafety,Phoenix-AZ,33.45,-112.07,MaxCognitiveLoadIndex,unitless,"
+            << max_load << ",2026-01-01/2026-12-31,0.88,barrier\n"
+            << "PHX-CYBERCORE,GovOS,Phoenix-AZ,33.45,-112.07,ConsensusThreshold,ratio,"
+            << threshold << ",2026-01-01/2026-12-31,0.91,consensus\n"
+            << "PHX-WATER-NODE,EcoLink,Phoenix-AZ,33.85,-112.27,PFBSLakePleasant,ngL,3.9,"
+            << "2024-11-15/2024-11-15,0.88,pfbs\n";
+    }
+    fs::rename(tmp, path);
+}
+
+double axisMax(const CyberswarmKernel& kernel, const std::string& axis) {
+    for (const auto& c : kernel.getConstraints()) {
+        if (c.axis == axis) {
+            return c.max_value;
+        }
+    }
+    return -1.0;
+}
+
+// intensity, duty, load, power, neuromod_amplitude, cognitive_load, legal_complexity
+std::vector<double> action(double power, double cognitive_load) {
+    return {0.5, 0.5, 50.0, power, 0.5, cognitive_load, 0.5};
+}
+
+}  // namespace
+
+int main() {
+    fs::path dir = fs::temp_directory_path() /
+                   ("phoenix_shard_test_" + std::to_string(getpid()));
+    fs::create_directories(dir);
+    const fs::path shard = dir / "shard.csv";
+
+    // Bounds and threshold come from the shard rows, not defaults
+    writeShard(shard, 0.65, 500, 0.75);
+    auto snapshot = buildShardSnapshot(shard.string(), 7);
+    CHECK(snapshot->version == 7);
+    CHECK(snapshot->nodes.size() == 4);
+    CHECK(axisMax(snapshot->kernel, "cognitive_load") == 0.65);
+    CHECK(axisMax(snapshot->kernel, "power") == 500);
+    CHECK(snapshot->consensus_threshold == 0.75);
+    CHECK(snapshot->kernel.checkViability(action(400, 0.6)));
+    CHECK(!snapshot->kernel.checkViability(action(400, 0.68)));
+    CHECK(!snapshot->kernel.checkViability(action(600, 0.6)));
+    for (const auto& c : snapshot->kernel.getConstraints()) {
+        CHECK(!c.is_violated);
+    }
+
+    {
+        ShardWatcher watcher(shard.string());
+        uint64_t first = watcher.read()->version;
+
+        // A pinned reader keeps its snapshot across a reload
+        {
+            auto pinned = watcher.read();
+            writeShard(shard, 0.5, 500, 0.8);
+            watcher.reloadNow();
+            CHECK(pinned->version == first);
+            CHECK(axisMax(pinned->kernel, "cognitive_load") == 0.65);
+
+            auto fresh = watcher.read();
+            CHECK(fresh->version > first);
+            CHECK(fresh->consensus_threshold == 0.8);
+            CHECK(!fresh->kernel.checkViability(action(400, 0.6)));
+        }
+
+        // A broken shard leaves the last good snapshot in place
+        uint64_t good = watcher.read()->version;
+        { std::ofstream(shard) << "nodeid,layer\n"; }
+        watcher.reloadNow();
+        CHECK(watcher.failedReloads() == 1);
+        CHECK(watcher.read()->version == good);
+
+        // File notifications trigger the reload on the watcher thread
+        watcher.start();
+        writeShard(shard, 0.9, 750, 0.6);
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (watcher.read()->consensus_threshold != 0.6 &&
+               std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        {
+            auto current = watcher.read();
+            CHECK(current->consensus_threshold == 0.6);
+            CHECK(axisMax(current->kernel, "cognitive_load") == 0.9);
+            CHECK(current->kernel.checkViability(action(700, 0.85)));
+        }
+
+        // Readers racing reloads always see a complete snapshot
+        std::atomic<bool> done{false};
+        std::atomic<uint64_t> torn{0};
+        std::vector<std::thread> readers;
+        for (int t = 0; t < 4; ++t) {
+            readers.emplace_back([&] {
+                while (!done.load()) {
+                    auto s = watcher.read();
+                    if (s->nodes.size() != 4 || axisMax(s->kernel, "power") != 750) {
+                        torn++;
+                    }
+                }
+            });
+        }
+        for (int i = 0; i < 50; ++i) {
+            watcher.reloadNow();
+        }
+        done = true;
+        for (auto& r : readers) {
+            r.join();
+        }
+        watcher.stop();
+        CHECK(torn.load() == 0);
+        CHECK(watcher.failedReloads() == 1);
+    }
+
+    fs::remove_all(dir);
+    return 0;
+}
@@ -0,0 +1,106 @@
+#include "spatial_index.hpp"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "test_support.hpp"
+
+namespace {
+
+std::vector<NeuroNode> randomNodes(std::mt19937& gen, size_t count,
+                                   double lat0, double lat1, double lon0, double lon1) {
+    std::uniform_real_distribution<> lat(lat0, lat1), lon(lon0, lon1);
+    std::vector<NeuroNode> nodes(count);
+    for (size_t i = 0; i < count; ++i) {
+        nodes[i].latitude = lat(gen);
+        nodes[i].longitude = lon(gen);
+        nodes[i].layer = i % 3 == 0 ? "EcoLink" : (i % 3 == 1 ? "BCIIngress" : "GovOS");
+    }
+    return nodes;
+}
+
+double bruteNearest(const std::vector<NeuroNode>& nodes, double lat, double lon,
+                    const char* layer = nullptr) {
+    double best = INFINITY;
+    for (const auto& n : nodes) {
+        if (!layer || n.layer == layer) {
+            best = std::min(best, haversineKm(lat, lon, n.latitude, n.longitude));
+        }
+    }
+    return best;
+}
+
+void checkAgainstBruteForce(const std::vector<NeuroNode>& nodes, const NodeSpatialIndex& index,
+                            std::mt19937& gen, double lat0, double lat1,
+                            double lon0, double lon1, int queries) {
+    std::uniform_real_distribution<> lat(lat0, lat1), lon(lon0, lon1), radius(0.0, 3000.0);
+    for (int q = 0; q < queries; ++q) {
+        double a = lat(gen), b = lon(gen), r = radius(gen);
+
+        auto got = index.queryRadius(a, b, r);
+        std::sort(got.begin(), got.end());
+        std::vector<size_t> expected;
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            if (haversineKm(a, b, nodes[i].latitude, nodes[i].longitude) <= r) {
+                expected.push_back(i);
+            }
+        }
+        CHECK(got == expected);
+
+        GeoBounds box{a - 1.0, b - 2.0, a + 1.0, b + 2.0};
+        auto in_box = index.queryBoundingBox(box);
+        std::sort(in_box.begin(), in_box.end());
+        expected.clear();
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            const auto& n = nodes[i];
+            if (n.latitude >= box.min_latitude && n.latitude <= box.max_latitude &&
+                n.longitude >= box.min_longitude && n.longitude <= box.max_longitude) {
+                expected.push_back(i);
+            }
+        }
+        CHECK(in_box == expected);
+
+        size_t nearest;
+        double distance;
+        CHECK(index.nearest(a, b, nearest, distance));
+        CHECK(std::fabs(distance - bruteNearest(nodes, a, b)) < 1e-9);
+    }
+}
+
+}  // namespace
+
+int main() {
+    std::mt19937 gen(1);
+
+    // Continental US, automatic cell size
+    auto conus = randomNodes(gen, 20000, 25, 49, -125, -67);
+    NodeSpatialIndex conus_index(conus);
+    checkAgainstBruteForce(conus, conus_index, gen, 15, 59, -130, -60, 300);
+
+    // Sparse high-latitude nodes around the globe: the great-circle path is
+    // much shorter than the path along a parallel, and the shortest way to
+    // a node can cross the antimeridian
+    for (size_t count : {20, 200}) {
+        for (double cell : {2.0, 10.0}) {
+            auto north = randomNodes(gen, count, 45, 75, -179, 179);
+            NodeSpatialIndex north_index(north, cell);
+            checkAgainstBruteForce(north, north_index, gen, 45, 75, -179, 179, 2000);
+        }
+    }
+
+    // Batch nearest EcoLink for every BCIIngress node
+    for (const auto& match : nearestEcoLinkForIngress(conus)) {
+        const auto& n = conus[match.node_index];
+        CHECK(n.layer == "BCIIngress");
+        CHECK(std::fabs(match.distance_km -
+                        bruteNearest(conus, n.latitude, n.longitude, "EcoLink")) < 1e-9);
+    }
+
+    // Empty index
+    NodeSpatialIndex empty;
+    size_t nearest;
+    double distance;
+    CHECK(!empty.nearest(0, 0, nearest, distance));
+    CHECK(empty.queryRadius(0, 0, 100).empty());
+    return 0;
+}
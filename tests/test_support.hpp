@@ -0,0 +1,13 @@
+#pragma once
+#include <cstdio>
+#include <cstdlib>
+
+// Minimal check macro; unlike assert() it stays active in Release builds
+#define CHECK(cond)                                                        \
+    do {                                                                   \
+        if (!(cond)) {                                                     \
+            std::fprintf(stderr, "%s:%d: CHECK failed: %s\n",              \
+                         __FILE__, __LINE__, #cond);                       \
+            std::exit(1);                                                  \
+        }                                                                  \
+    } while (0)
@@ -0,0 +1,96 @@
+#include "time_index.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "test_support.hpp"
+
+namespace {
+
+void checkDates() {
+    int32_t day = 123;
+    CHECK(parseIsoDay("1970-01-01", day) && day == 0);
+    CHECK(parseIsoDay("1969-12-31", day) && day == -1);
+    CHECK(parseIsoDay("2000-03-01", day) && day == 11017);
+
+    // Walk every date from 1900 to 2100 and compare with a running count
+    static const int kDays[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    int32_t expected = -25567;  // 1900-01-01
+    char text[16];
+    for (int year = 1900; year <= 2100; ++year) {
+        bool leap = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+        for (int month = 1; month <= 12; ++month) {
+            int length = kDays[month - 1] + (month == 2 && leap);
+            for (int dom = 1; dom <= 31; ++dom) {
+                std::snprintf(text, sizeof(text), "%04d-%02d-%02d", year, month, dom);
+                bool valid = parseIsoDay(text, day);
+                CHECK(valid == (dom <= length));
+                if (valid) {
+                    CHECK(day == expected++);
+                }
+            }
+        }
+    }
+
+    CHECK(!parseIsoDay("2026-02-31", day));
+    CHECK(!parseIsoDay("2026-04-31", day));
+    CHECK(!parseIsoDay("2025-02-29", day));
+    CHECK(!parseIsoDay("1900-02-29", day));
+    CHECK(parseIsoDay("2000-02-29", day));
+    CHECK(parseIsoDay("2024-02-29", day));
+    CHECK(!parseIsoDay("2026-13-01", day));
+    CHECK(!parseIsoDay("2026-00-10", day));
+    CHECK(!parseIsoDay("2026-01-00", day));
+    CHECK(!parseIsoDay("2026-1-01", day));
+    CHECK(!parseIsoDay("2026/01/01", day));
+    CHECK(!parseIsoDay("2026-01-0a", day));
+
+    int32_t start, end;
+    CHECK(parseWindowDays("2026-01-01/2026-01-31", start, end) && end - start == 30);
+    CHECK(parseWindowDays("2026-03-01/2026-03-01", start, end) && start == end);
+    CHECK(!parseWindowDays("2026-02-01/2026-02-31", start, end));
+    CHECK(!parseWindowDays("2026-02-01/2026-01-31", start, end));
+    CHECK(!parseWindowDays("2026-02-01", start, end));
+}
+
+void checkIntervals(std::mt19937& gen, size_t count) {
+    std::uniform_int_distribution<int32_t> start(20000, 21000), length(0, 120), broken(0, 19);
+    std::vector<NeuroNode> nodes(count);
+    for (auto& n : nodes) {
+        if (broken(gen) == 0) {
+            continue;  // unparsed window, never indexed
+        }
+        n.windowStartDay = start(gen);
+        n.windowEndDay = n.windowStartDay + length(gen);
+    }
+    NodeTimeIndex index(nodes);
+
+    std::uniform_int_distribution<int32_t> query(19900, 21200), span(0, 60);
+    for (int q = 0; q < 500; ++q) {
+        int32_t from = query(gen), to = from + (q % 2 ? span(gen) : 0);
+        auto got = q % 2 ? index.overlapping(from, to) : index.activeOn(from);
+        std::sort(got.begin(), got.end());
+        std::vector<size_t> expected;
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            if (nodes[i].windowStartDay <= nodes[i].windowEndDay &&
+                nodes[i].windowStartDay <= to && from <= nodes[i].windowEndDay) {
+                expected.push_back(i);
+            }
+        }
+        CHECK(got == expected);
+    }
+    CHECK(index.overlapping(21000, 20000).empty());
+}
+
+}  // namespace
+
+int main() {
+    checkDates();
+
+    // Sizes around powers of two exercise the implicit tree's ragged edge
+    std::mt19937 gen(3);
+    for (size_t count : {0, 1, 2, 3, 7, 8, 9, 63, 64, 65, 1000, 4097}) {
+        checkIntervals(gen, count);
+    }
+    return 0;
+}
@@ -0,0 +1,135 @@
+#include "violation_events.hpp"
+#include "cyberswarm_kernel.hpp"
+#include <cstring>
+#include <thread>
+#include <vector>
+#include "test_support.hpp"
+
+namespace {
+
+ViolationEvent numbered(int64_t n) {
+    ViolationEvent event{};
+    event.timestamp_ns = n;
+    event.value = static_cast<double>(n);
+    return event;
+}
+
+void checkRing() {
+    ViolationEventRing ring(5);
+    CHECK(ring.capacity() == 8);
+
+    // Fill, overflow, then drain across the wrap point several times
+    int64_t next_in = 0, next_out = 0;
+    ViolationEvent out[16];
+    for (int round = 0; round < 5; ++round) {
+        while (ring.tryPush(numbered(next_in))) {
+            ++next_in;
+        }
+        size_t n = ring.drain(out, 3);
+        CHECK(n == 3);
+        for (size_t i = 0; i < n; ++i) {
+            CHECK(out[i].timestamp_ns == next_out++);
+        }
+    }
+    CHECK(ring.droppedEvents() == 5);
+    size_t n;
+    while ((n = ring.drain(out, 16)) > 0) {
+        for (size_t i = 0; i < n; ++i) {
+            CHECK(out[i].timestamp_ns == next_out++);
+        }
+    }
+    CHECK(next_out == next_in);
+
+    // One producer and one consumer thread: every event arrives once, in order
+    ViolationEventRing shared(64);
+    const int64_t total = 200000;
+    std::thread producer([&] {
+        for (int64_t i = 0; i < total; ++i) {
+            while (!shared.tryPush(numbered(i))) {
+                std::this_thread::yield();
+            }
+        }
+    });
+    int64_t expected = 0;
+    while (expected < total) {
+        size_t got = shared.drain(out, 16);
+        for (size_t i = 0; i < got; ++i) {
+            CHECK(out[i].timestamp_ns == expected);
+            CHECK(out[i].value == static_cast<double>(expected));
+            ++expected;
+        }
+        if (got == 0) {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+}
+
+void checkKernelEvents() {
+    CyberswarmKernel kernel;
+    ViolationEventRing ring(64);
+    kernel.attachEventSink(&ring);
+    const size_t cognitive = 5;  // [0, 0.7]
+    CHECK(kernel.getConstraints()[cognitive].axis == "cognitive_load");
+
+    kernel.updateConstraint(cognitive, 0.5);   // inside, no event
+    kernel.updateConstraint(cognitive, 0.9);   // above max
+    kernel.updateConstraint(cognitive, 0.95);  // still above, no event
+    kernel.updateConstraint(cognitive, -0.1);  // jumps below min
+    kernel.updateConstraint(cognitive, 0.3);   // recovers from below
+    kernel.updateConstraint("power", 800.0);   // by name
+
+    ViolationEvent events[8];
+    size_t n = ring.drain(events, 8);
+    CHECK(n == 4);
+    CHECK(events[0].kind == ViolationEventKind::VIOLATION);
+    CHECK(events[0].axis_id == cognitive && events[0].bound == 0.7 && events[0].value == 0.9);
+    CHECK(events[1].kind == ViolationEventKind::VIOLATION && events[1].bound == 0.0);
+    CHECK(events[2].kind == ViolationEventKind::RECOVERY && events[2].bound == 0.0);
+    CHECK(events[3].axis_id == 3 && events[3].bound == 750.0);
+    for (size_t i = 1; i < n; ++i) {
+        CHECK(events[i].timestamp_ns >= events[i - 1].timestamp_ns);
+    }
+    for (size_t i = 0; i < n; ++i) {
+        for (uint8_t b : events[i].reserved) {
+            CHECK(b == 0);
+        }
+    }
+
+    // Detached kernels still track state without emitting
+    kernel.attachEventSink(nullptr);
+    kernel.updateConstraint(cognitive, 2.0);
+    CHECK(kernel.getConstraints()[cognitive].is_violated);
+    CHECK(ring.drain(events, 8) == 0);
+
+    // Binary log round trip: 32-byte records, reserved bytes zero
+    kernel.attachEventSink(&ring);
+    kernel.updateConstraint(cognitive, 0.1);
+    kernel.updateConstraint(cognitive, 0.8);
+    std::FILE* log = std::tmpfile();
+    CHECK(log);
+    CHECK(drainViolationEventsToFile(ring, log) == 2);
+    CHECK(std::ftell(log) == 2 * 32);
+    std::rewind(log);
+    unsigned char raw[2 * 32];
+    CHECK(std::fread(raw, 1, sizeof(raw), log) == sizeof(raw));
+    std::fclose(log);
+    ViolationEvent first;
+    std::memcpy(&first, raw, sizeof(first));
+    CHECK(first.kind == ViolationEventKind::RECOVERY && first.value == 0.1);
+    for (int b = 26; b < 32; ++b) {
+        CHECK(raw[b] == 0 && raw[32 + b] == 0);
+    }
+
+    std::string line = formatViolationEvent(events[0], "cognitive_load");
+    CHECK(line.find("cognitive_load") != std::string::npos);
+    CHECK(line.find("0.900") != std::string::npos);
+}
+
+}  // namespace
+
+int main() {
+    checkRing();
+    checkKernelEvents();
+    return 0;
+}